@@ -0,0 +1,68 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <PotiCollection.h>
+
+/*
+  Example to handle potentiometers of different
+  Poti classes with one collection.
+
+  Three potentiometers are used: a volume with
+  stabilized analog values (StablePoti), a program
+  selection with 10 mapping values (MappedPoti) and
+  a balance with a center position (CenteredPoti).
+  The collection calls hasChanged() of the real
+  class of each object and the changed objects are
+  written by their index.
+
+  Prerequisite are potentiometers connected
+  with variable voltage pin to the analog input
+  pins. Output will be written to Serial.
+*/
+
+#define VOLUME_PIN A5                 // must be analog pin A0 to A7
+#define PROGRAM_PIN A6                // must be analog pin A0 to A7
+#define BALANCE_PIN A7                // must be analog pin A0 to A7
+#define READ_CYCLE_MILLIS 10          // minimum difference between two actual read of analog raw value
+
+StablePoti volume = StablePoti(VOLUME_PIN, READ_CYCLE_MILLIS, 8, 2);
+MappedPoti program = MappedPoti(PROGRAM_PIN, READ_CYCLE_MILLIS, 4, 0, 10, 0);
+CenteredPoti balance = CenteredPoti(BALANCE_PIN, READ_CYCLE_MILLIS, 4, 0, 21, 0, 20, 0);
+
+PotiCollection<3> potis;
+
+// names of the objects by index
+const char* names[3] = {"volume", "program", "balance"};
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  potis.add(volume);
+  potis.add(program);
+  potis.add(balance);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  // react on changing values by writing the relevant information
+  if(potis.hasChanged()){
+    for(uint8_t i = 0 ; i < potis.getNumPotis() ; i++){
+      if(potis.hasChanged(i)){
+        Serial.print(names[i]);
+        Serial.print(": curVal=");
+        Serial.print(potis.getValue(i));
+        if(potis.getMappedValue(i) != POTI_MAPPING_UNDEFINED){
+          Serial.print(", curMapVal=");
+          Serial.print(potis.getMappedValue(i));
+        }
+        Serial.print("\n");
+      }
+    }
+  }
+}
@@ -0,0 +1,229 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <CenteredPoti.h>
+#include <HalfShiftMappedPoti.h>
+#include <TaperedPoti.h>
+#include <StablePotiBank.h>
+#include <MultiMappedPoti.h>
+#include <VelocityPoti.h>
+#include <WideMappedPoti.h>
+#include <SnapshotPoti.h>
+#include <PotiCollection.h>
+#include <HistoryPoti.h>
+#include <SettledPoti.h>
+#include <PotiScheduler.h>
+#include <ThresholdPoti.h>
+
+/*
+  Example to check and show the memory footprint of
+  the Poti classes.
+
+  The RAM usage per instance (sizeof) of each class is
+  checked during compilation against a budget for the
+  used microcontroller architecture. If a class needs
+  more memory than its budget, the compilation fails.
+  The budgets are defined for 8 bit AVR, 32 bit and
+  64 bit (host) architectures.
+
+  For the flash and RAM usage of one class incl. all
+  used functions, compile the example several times
+  with the different values of FOOTPRINT_CLASS and
+  compare the program storage space and dynamic memory
+  reported by the compiler with the one of value 0
+  (no Poti object). The first use of MappedPoti or its
+  subclasses adds the floating point functions of the
+  compiler library to the program storage space.
+
+  Prerequisite is the Serial class for writing
+  the output. No potentiometer is necessary.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define FOOTPRINT_CLASS 0             // 0 none, 1 Poti, 2 StablePoti, 3 MappedPoti, 4 CenteredPoti,
+                                      // 5 HalfShiftMappedPoti, 6 TaperedPoti, 7 StablePotiBank<8>,
+                                      // 8 MultiMappedPoti<3>, 9 VelocityPoti<StablePoti>,
+                                      // 10 WideMappedPoti, 11 SnapshotPoti<MappedPoti>,
+                                      // 12 PotiCollection<4> with MappedPoti and CenteredPoti
+                                      // 13 HistoryPoti<MappedPoti, 8>, 14 SettledPoti<MappedPoti>
+                                      // 15 PotiScheduler<8> with MappedPoti and CenteredPoti
+                                      // 16 ThresholdPoti<StablePoti>
+
+#if defined(__AVR__)
+// 8 bit AVR, 2 Byte for int and pointers, no alignment
+#define BUDGET_POTI 12
+#define BUDGET_STABLE_POTI 19
+#define BUDGET_MAPPED_POTI 28
+#define BUDGET_CENTERED_POTI 34
+#define BUDGET_HALF_SHIFT_MAPPED_POTI 28
+#define BUDGET_TAPERED_POTI 32
+#define BUDGET_STABLE_POTI_BANK_8 91
+#define BUDGET_MULTI_MAPPED_POTI_3 64
+#define BUDGET_VELOCITY_POTI 32
+#define BUDGET_WIDE_MAPPED_POTI 32
+#define BUDGET_SNAPSHOT_POTI 45
+#define BUDGET_POTI_COLLECTION_4 22
+#define BUDGET_HISTORY_POTI_8 94
+#define BUDGET_SETTLED_POTI 39
+#define BUDGET_POTI_SCHEDULER_8 172
+#define BUDGET_THRESHOLD_POTI 26
+#elif defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ == 4
+// 32 bit, 4 Byte for int, long and pointers with alignment
+#define BUDGET_POTI 20
+#define BUDGET_STABLE_POTI 36
+#define BUDGET_MAPPED_POTI 52
+#define BUDGET_CENTERED_POTI 64
+#define BUDGET_HALF_SHIFT_MAPPED_POTI 52
+#define BUDGET_TAPERED_POTI 60
+#define BUDGET_STABLE_POTI_BANK_8 160
+#define BUDGET_MULTI_MAPPED_POTI_3 112
+#define BUDGET_VELOCITY_POTI 52
+#define BUDGET_WIDE_MAPPED_POTI 56
+#define BUDGET_SNAPSHOT_POTI 80
+#define BUDGET_POTI_COLLECTION_4 40
+#define BUDGET_HISTORY_POTI_8 136
+#define BUDGET_SETTLED_POTI 68
+#define BUDGET_POTI_SCHEDULER_8 208
+#define BUDGET_THRESHOLD_POTI 48
+#else
+// 64 bit host, 8 Byte for long and pointers with alignment
+#define BUDGET_POTI 32
+#define BUDGET_STABLE_POTI 48
+#define BUDGET_MAPPED_POTI 72
+#define BUDGET_CENTERED_POTI 88
+#define BUDGET_HALF_SHIFT_MAPPED_POTI 72
+#define BUDGET_TAPERED_POTI 88
+#define BUDGET_STABLE_POTI_BANK_8 176
+#define BUDGET_MULTI_MAPPED_POTI_3 128
+#define BUDGET_VELOCITY_POTI 80
+#define BUDGET_WIDE_MAPPED_POTI 72
+#define BUDGET_SNAPSHOT_POTI 104
+#define BUDGET_POTI_COLLECTION_4 72
+#define BUDGET_HISTORY_POTI_8 192
+#define BUDGET_SETTLED_POTI 96
+#define BUDGET_POTI_SCHEDULER_8 312
+#define BUDGET_THRESHOLD_POTI 64
+#endif
+
+static_assert(sizeof(Poti) <= BUDGET_POTI, "Poti exceeds its memory budget");
+static_assert(sizeof(StablePoti) <= BUDGET_STABLE_POTI, "StablePoti exceeds its memory budget");
+static_assert(sizeof(MappedPoti) <= BUDGET_MAPPED_POTI, "MappedPoti exceeds its memory budget");
+static_assert(sizeof(CenteredPoti) <= BUDGET_CENTERED_POTI, "CenteredPoti exceeds its memory budget");
+static_assert(sizeof(HalfShiftMappedPoti) <= BUDGET_HALF_SHIFT_MAPPED_POTI, "HalfShiftMappedPoti exceeds its memory budget");
+static_assert(sizeof(TaperedPoti) <= BUDGET_TAPERED_POTI, "TaperedPoti exceeds its memory budget");
+static_assert(sizeof(StablePotiBank<8>) <= BUDGET_STABLE_POTI_BANK_8, "StablePotiBank<8> exceeds its memory budget");
+static_assert(sizeof(MultiMappedPoti<3>) <= BUDGET_MULTI_MAPPED_POTI_3, "MultiMappedPoti<3> exceeds its memory budget");
+static_assert(sizeof(VelocityPoti<StablePoti>) <= BUDGET_VELOCITY_POTI, "VelocityPoti<StablePoti> exceeds its memory budget");
+static_assert(sizeof(WideMappedPoti) <= BUDGET_WIDE_MAPPED_POTI, "WideMappedPoti exceeds its memory budget");
+static_assert(sizeof(SnapshotPoti<MappedPoti>) <= BUDGET_SNAPSHOT_POTI, "SnapshotPoti<MappedPoti> exceeds its memory budget");
+static_assert(sizeof(PotiCollection<4>) <= BUDGET_POTI_COLLECTION_4, "PotiCollection<4> exceeds its memory budget");
+static_assert(sizeof(HistoryPoti<MappedPoti, 8>) <= BUDGET_HISTORY_POTI_8, "HistoryPoti<MappedPoti, 8> exceeds its memory budget");
+static_assert(sizeof(SettledPoti<MappedPoti>) <= BUDGET_SETTLED_POTI, "SettledPoti<MappedPoti> exceeds its memory budget");
+static_assert(sizeof(PotiScheduler<8>) <= BUDGET_POTI_SCHEDULER_8, "PotiScheduler<8> exceeds its memory budget");
+static_assert(sizeof(ThresholdPoti<StablePoti>) <= BUDGET_THRESHOLD_POTI, "ThresholdPoti<StablePoti> exceeds its memory budget");
+
+const uint16_t TAPER[] PROGMEM = {0, 0, 102, 512, 1023, 1023};
+const uint8_t PINS[8] = {INPUT_PIN, INPUT_PIN, INPUT_PIN, INPUT_PIN, INPUT_PIN, INPUT_PIN, INPUT_PIN, INPUT_PIN};
+
+#if FOOTPRINT_CLASS == 1
+Poti pot = Poti(INPUT_PIN, 100);
+#elif FOOTPRINT_CLASS == 2
+StablePoti pot = StablePoti(INPUT_PIN, 100, 4, 2);
+#elif FOOTPRINT_CLASS == 3
+MappedPoti pot = MappedPoti(INPUT_PIN, 100, 4, 2, 10, 5);
+#elif FOOTPRINT_CLASS == 4
+CenteredPoti pot = CenteredPoti(INPUT_PIN, 100, 4, 2, 11, 5, 20, 0);
+#elif FOOTPRINT_CLASS == 5
+HalfShiftMappedPoti pot = HalfShiftMappedPoti(INPUT_PIN, 100, 4, 2, 10, 5);
+#elif FOOTPRINT_CLASS == 6
+TaperedPoti pot = TaperedPoti(INPUT_PIN, 100, 4, 2, 10, TAPER, 3);
+#elif FOOTPRINT_CLASS == 7
+StablePotiBank<8> pot = StablePotiBank<8>(PINS, 100, 4, 2);
+#elif FOOTPRINT_CLASS == 8
+MultiMappedPoti<3> pot = MultiMappedPoti<3>(INPUT_PIN, 100, 4, 2);
+#elif FOOTPRINT_CLASS == 9
+VelocityPoti<StablePoti> pot = VelocityPoti<StablePoti>(INPUT_PIN, 100, 4, 2);
+#elif FOOTPRINT_CLASS == 10
+WideMappedPoti pot = WideMappedPoti(INPUT_PIN, 100, 4, 2, 1024);
+#elif FOOTPRINT_CLASS == 11
+SnapshotPoti<MappedPoti> pot = SnapshotPoti<MappedPoti>(INPUT_PIN, 100, 4, 2, 10, 5);
+#elif FOOTPRINT_CLASS == 12
+MappedPoti mappedPot = MappedPoti(INPUT_PIN, 100, 4, 2, 10, 5);
+CenteredPoti centeredPot = CenteredPoti(INPUT_PIN, 100, 4, 2, 11, 5, 20, 0);
+PotiCollection<4> pot;
+#elif FOOTPRINT_CLASS == 13
+HistoryPoti<MappedPoti, 8> pot = HistoryPoti<MappedPoti, 8>(INPUT_PIN, 100, 4, 2, 10, 5);
+#elif FOOTPRINT_CLASS == 14
+SettledPoti<MappedPoti> pot = SettledPoti<MappedPoti>(INPUT_PIN, 100, 4, 2, 10, 5);
+#elif FOOTPRINT_CLASS == 15
+MappedPoti mappedPot = MappedPoti(INPUT_PIN, 100, 4, 2, 10, 5);
+CenteredPoti centeredPot = CenteredPoti(INPUT_PIN, 100, 4, 2, 11, 5, 20, 0);
+PotiScheduler<8> pot;
+#elif FOOTPRINT_CLASS == 16
+ThresholdPoti<StablePoti> pot = ThresholdPoti<StablePoti>(INPUT_PIN, 100, 4, 2);
+#endif
+
+
+// for showing the size of a class
+void printSize(const char* name, size_t size, size_t budget){
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print((int)size);
+  Serial.print(" Byte, budget ");
+  Serial.print((int)budget);
+  Serial.println(" Byte");
+}
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  printSize("Poti", sizeof(Poti), BUDGET_POTI);
+  printSize("StablePoti", sizeof(StablePoti), BUDGET_STABLE_POTI);
+  printSize("MappedPoti", sizeof(MappedPoti), BUDGET_MAPPED_POTI);
+  printSize("CenteredPoti", sizeof(CenteredPoti), BUDGET_CENTERED_POTI);
+  printSize("HalfShiftMappedPoti", sizeof(HalfShiftMappedPoti), BUDGET_HALF_SHIFT_MAPPED_POTI);
+  printSize("TaperedPoti", sizeof(TaperedPoti), BUDGET_TAPERED_POTI);
+  printSize("StablePotiBank<8>", sizeof(StablePotiBank<8>), BUDGET_STABLE_POTI_BANK_8);
+  printSize("MultiMappedPoti<3>", sizeof(MultiMappedPoti<3>), BUDGET_MULTI_MAPPED_POTI_3);
+  printSize("VelocityPoti<StablePoti>", sizeof(VelocityPoti<StablePoti>), BUDGET_VELOCITY_POTI);
+  printSize("WideMappedPoti", sizeof(WideMappedPoti), BUDGET_WIDE_MAPPED_POTI);
+  printSize("SnapshotPoti<MappedPoti>", sizeof(SnapshotPoti<MappedPoti>), BUDGET_SNAPSHOT_POTI);
+  printSize("PotiCollection<4>", sizeof(PotiCollection<4>), BUDGET_POTI_COLLECTION_4);
+  printSize("HistoryPoti<MappedPoti, 8>", sizeof(HistoryPoti<MappedPoti, 8>), BUDGET_HISTORY_POTI_8);
+  printSize("SettledPoti<MappedPoti>", sizeof(SettledPoti<MappedPoti>), BUDGET_SETTLED_POTI);
+  printSize("PotiScheduler<8>", sizeof(PotiScheduler<8>), BUDGET_POTI_SCHEDULER_8);
+  printSize("ThresholdPoti<StablePoti>", sizeof(ThresholdPoti<StablePoti>), BUDGET_THRESHOLD_POTI);
+
+#if FOOTPRINT_CLASS == 12 || FOOTPRINT_CLASS == 15
+  pot.add(mappedPot);
+  pot.add(centeredPot);
+#endif
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  // using the object, so that all functions are part of the program
+#if FOOTPRINT_CLASS == 7 || FOOTPRINT_CLASS == 12
+  if(pot.hasChanged()){
+    Serial.println(pot.getValue(0));
+  }
+#elif FOOTPRINT_CLASS == 8
+  if(pot.hasChanged()){
+    Serial.println(pot.getOutputValue(0));
+  }
+#elif FOOTPRINT_CLASS == 15
+  if(pot.poll() > 0){
+    Serial.println(pot.getPoti(pot.getChanged(0))->getValue());
+  }
+#elif FOOTPRINT_CLASS > 0
+  if(pot.hasChanged()){
+    Serial.println(pot.getValue());
+  }
+#endif
+}
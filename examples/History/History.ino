@@ -0,0 +1,68 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <HistoryPoti.h>
+
+/*
+  Example to detect a gesture by the history of the
+  last changes of the connected potentiometer.
+
+  A flick is a fast turn of the potentiometer over at
+  least FLICK_RANGE mapping values within FLICK_MILLIS
+  milliseconds. When a flick is detected, the mapping
+  value before the flick is taken from the history,
+  e.g. for undoing the flick. Minimum, maximum and
+  average of the mapping values of the flick are
+  written too.
+
+  Prerequisite is an potentiometer connected
+  with variable voltage pin to analog input
+  pin. Output will be written to Serial.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define NUM_MAP_VALUES 20             // max 100, raw values will be mapped to this number of mapping values
+#define READ_CYCLE_MILLIS 10          // minimum difference between two actual read of analog raw value
+#define NUM_HISTORY 16                // number of stored changes
+#define FLICK_MILLIS 300              // time window of a flick
+#define FLICK_RANGE 10                // minimum number of mapping values of a flick
+
+HistoryPoti<MappedPoti, NUM_HISTORY> pot = HistoryPoti<MappedPoti, NUM_HISTORY>(INPUT_PIN, READ_CYCLE_MILLIS, 0, 0, NUM_MAP_VALUES, 0);
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  uint8_t num;
+
+  // react on changing states by analysing the history
+  if(pot.hasChanged()){
+    Serial.print("curMapVal=");
+    Serial.println(pot.getMappedValue());
+
+    // changes within the time window of a flick
+    num = pot.getHistoryNum(FLICK_MILLIS);
+    if(pot.getHistoryMax(num, true) - pot.getHistoryMin(num, true) >= FLICK_RANGE){
+      Serial.print("flick, min=");
+      Serial.print(pot.getHistoryMin(num, true));
+      Serial.print(", max=");
+      Serial.print(pot.getHistoryMax(num, true));
+      Serial.print(", average=");
+      Serial.print(pot.getHistoryAverage(num, true));
+      // the entry before the time window is the value before the flick
+      if(num < pot.getHistoryNum()){
+        Serial.print(", undo to ");
+        Serial.print(pot.getHistoryMappedValue(num));
+      }
+      Serial.print("\n");
+    }
+  }
+}
@@ -0,0 +1,221 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+// virtual clock of the simulation, must be defined before including the Poti classes
+unsigned long virtualMillis = 1;
+#define POTI_MILLIS() virtualMillis
+
+#include <MappedPoti.h>
+#include <TimestampedPoti.h>
+
+/*
+  Example for measuring the latency between a movement of
+  a potentiometer and the change reported by hasChanged()
+  for different configurations of StablePoti and MappedPoti.
+
+  The potentiometer is simulated with noise on a virtual
+  clock (defined by POTI_MILLIS() before the include). For
+  each configuration NUM_TRIALS movements are simulated,
+  each starting at a different time relative to the read
+  cycle:
+  - step: the value jumps from STEP_FROM to STEP_TO
+  - ramp: the value moves linear from STEP_FROM to STEP_TO
+          within RAMP_MILLIS milliseconds
+
+  The latency is the time from the movement reaching its
+  target until the change, that reports the target, based
+  on the timestamp of the measurement (getChangeMillis()).
+  The target is reached for StablePoti (numMapping 0), when
+  the value is within TOLERANCE of STEP_TO, and for
+  MappedPoti, when the mapping value of STEP_TO is reported.
+  The median (p50) and the 99th percentile (p99) of the
+  latencies are written to Serial.
+
+  No potentiometer is necessary.
+*/
+
+#define NUM_TRIALS 100                // simulated movements per configuration and input
+#define STEP_FROM 200                 // analog value before the movement
+#define STEP_TO 800                   // analog value after the movement
+#define RAMP_MILLIS 200               // duration of the ramp
+#define NOISE 2                       // maximum noise amplitude in analog values
+#define TOLERANCE 5                   // tolerance of StablePoti values for reaching the target
+#define WARMUP_MILLIS 500             // simulated time before the movement
+#define MAX_LATENCY 2000              // maximum simulated time after the movement
+
+
+/*
+  Configuration of a simulated potentiometer.
+*/
+struct LatencyConfig {
+  uint8_t readCycleMillis;
+  uint8_t weightPrev;
+  uint8_t addNumRawAvg;
+  uint8_t numMapping;                 // 0 for StablePoti without mapping
+};
+
+const LatencyConfig CONFIGS[] = {
+  {0, 0, 0, 0},
+  {10, 0, 0, 0},
+  {10, 4, 0, 0},
+  {10, 8, 4, 0},
+  {50, 4, 2, 0},
+  {10, 0, 0, 10},
+  {10, 4, 2, 10},
+  {10, 8, 4, 100},
+  {50, 12, 7, 10}
+};
+
+// simulated analog value of the current movement
+unsigned long moveStartMillis;
+unsigned long moveEndMillis;
+uint16_t noiseSeed = 1;
+
+
+// returns the simulated analog value at the current virtual time
+int getSimValue(){
+  long value;
+
+  if(virtualMillis < moveStartMillis){
+    value = STEP_FROM;
+  }
+  else if(virtualMillis >= moveEndMillis){
+    value = STEP_TO;
+  }
+  else{
+    value = STEP_FROM + (long)(STEP_TO - STEP_FROM) * (virtualMillis - moveStartMillis)
+      / (moveEndMillis - moveStartMillis);
+  }
+
+  // xorshift pseudo random noise
+  noiseSeed ^= noiseSeed << 7;
+  noiseSeed ^= noiseSeed >> 9;
+  noiseSeed ^= noiseSeed << 8;
+  return value + (int)(noiseSeed % (2 * NOISE + 1)) - NOISE;
+}
+
+
+/*
+  Subclass of class MappedPoti with timestamps and simulated raw values.
+*/
+class SimPoti : public TimestampedPoti<MappedPoti> {
+  public:
+    SimPoti(const LatencyConfig& config)
+      : TimestampedPoti<MappedPoti>(0, config.readCycleMillis, config.weightPrev,
+          config.addNumRawAvg, (config.numMapping == 0 ? 100 : config.numMapping), 0){
+    }
+
+    int getRawValue(){
+      return getSimValue();
+    }
+};
+
+
+/*
+  Subclass of class StablePoti with timestamps and simulated raw values.
+*/
+class SimStablePoti : public TimestampedPoti<StablePoti> {
+  public:
+    SimStablePoti(const LatencyConfig& config)
+      : TimestampedPoti<StablePoti>(0, config.readCycleMillis, config.weightPrev, config.addNumRawAvg){
+    }
+
+    int getRawValue(){
+      return getSimValue();
+    }
+};
+
+
+// simulates one movement and returns the latency in milliseconds
+unsigned long measureLatency(const LatencyConfig& config, unsigned long offset, unsigned long rampMillis){
+  SimPoti mappedPoti(config);
+  SimStablePoti stablePoti(config);
+  uint8_t targetMapping = 0;
+  bool reached;
+
+  virtualMillis = 1000;
+  moveStartMillis = virtualMillis + WARMUP_MILLIS + offset;
+  moveEndMillis = moveStartMillis + rampMillis;
+  // mapping value of the target, without noise
+  if(config.numMapping > 0){
+    targetMapping = MappedPoti::calcMapping(STEP_TO, 0, 0, config.numMapping, 0, 1023);
+  }
+
+  for( ; virtualMillis < moveEndMillis + MAX_LATENCY ; virtualMillis++){
+    if(config.numMapping == 0){
+      reached = stablePoti.hasChanged() && virtualMillis >= moveEndMillis
+        && abs(stablePoti.getValue() - STEP_TO) <= TOLERANCE;
+      if(reached){
+        return stablePoti.getChangeMillis() - moveEndMillis;
+      }
+    }
+    else{
+      reached = mappedPoti.hasChanged() && virtualMillis >= moveStartMillis
+        && mappedPoti.getMappedValue() == targetMapping;
+      if(reached){
+        // mapping reached during the ramp means no latency
+        return (mappedPoti.getChangeMillis() > moveEndMillis ? mappedPoti.getChangeMillis() - moveEndMillis : 0);
+      }
+    }
+  }
+  return MAX_LATENCY;
+}
+
+
+// sorts the latencies and writes p50 and p99
+void printPercentiles(const char* name, unsigned long* latencies){
+  unsigned long tmp;
+
+  for(int i = 1 ; i < NUM_TRIALS ; i++){
+    for(int k = i ; k > 0 && latencies[k - 1] > latencies[k] ; k--){
+      tmp = latencies[k];
+      latencies[k] = latencies[k - 1];
+      latencies[k - 1] = tmp;
+    }
+  }
+
+  Serial.print(name);
+  Serial.print(" p50=");
+  Serial.print(latencies[NUM_TRIALS / 2]);
+  Serial.print(" p99=");
+  Serial.print(latencies[(NUM_TRIALS * 99) / 100]);
+}
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  unsigned long latencies[NUM_TRIALS];
+
+  for(uint8_t c = 0 ; c < sizeof(CONFIGS) / sizeof(CONFIGS[0]) ; c++){
+    Serial.print("readCycleMillis=");
+    Serial.print(CONFIGS[c].readCycleMillis);
+    Serial.print(", weightPrev=");
+    Serial.print(CONFIGS[c].weightPrev);
+    Serial.print(", addNumRawAvg=");
+    Serial.print(CONFIGS[c].addNumRawAvg);
+    Serial.print(", numMapping=");
+    Serial.print(CONFIGS[c].numMapping);
+    Serial.print(": ");
+
+    for(int i = 0 ; i < NUM_TRIALS ; i++){
+      latencies[i] = measureLatency(CONFIGS[c], i, 0);
+    }
+    printPercentiles("step", latencies);
+
+    for(int i = 0 ; i < NUM_TRIALS ; i++){
+      latencies[i] = measureLatency(CONFIGS[c], i, RAMP_MILLIS);
+    }
+    printPercentiles(", ramp", latencies);
+    Serial.print(" millis\n");
+  }
+  Serial.print("\n");
+}
@@ -0,0 +1,185 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+// virtual clock of the simulation, must be defined before including the Poti classes
+unsigned long virtualMillis = 1;
+#define POTI_MILLIS() virtualMillis
+
+#include <CenteredPoti.h>
+
+/*
+  Example for load tests with a big number of simulated
+  MappedPoti and CenteredPoti channels. Each channel has
+  its own synthetic motion (knob turned forth and back
+  with an individual period or resting) and its own noise.
+
+  The channels are stepped on a virtual clock (defined by
+  POTI_MILLIS() before the include), so that a simulated
+  time of SIM_MILLIS milliseconds is processed as fast as
+  possible. After each run the throughput in channel updates
+  (hasChanged() calls) per real second and the event rates
+  (hasChanged() returned true) per simulated second are
+  written to Serial.
+
+  The number of channels is limited by the available RAM.
+  The memory per channel (object on the heap and pointer)
+  is written to Serial at the start. No potentiometer is
+  necessary.
+*/
+
+#if defined(__AVR__)
+#define NUM_CHANNELS 32               // number of simulated channels, half mapped and half centered
+#else
+#define NUM_CHANNELS 10000            // number of simulated channels, half mapped and half centered
+#endif
+#define SIM_MILLIS 2000               // simulated milliseconds per run
+#define MAX_NOISE 6                   // maximum noise amplitude of a channel in analog values
+
+
+/*
+  Synthetic noise and motion profile of one simulated channel.
+*/
+class SimProfile {
+  private:
+    uint16_t _seed;
+    uint16_t _periodMillis;
+    uint8_t _noise;
+    int _restValue;
+
+  public:
+    void init(uint16_t channel){
+      _seed = channel * 7919 + 1;
+      _noise = channel % (MAX_NOISE + 1);
+      // every fourth channel rests, the others are turned with different speed
+      _periodMillis = ((channel & 0x03) == 0 ? 0 : 500 + (channel * 37) % 3000);
+      _restValue = (channel * 101) % 1024;
+    }
+
+    int getValue(unsigned long current){
+      long value = _restValue;
+
+      if(_periodMillis > 0){
+        // triangle from 0 to 1023 and back
+        value = (current % _periodMillis) * 2048 / _periodMillis;
+        if(value > 1023){
+          value = 2047 - value;
+        }
+      }
+
+      // xorshift pseudo random noise
+      _seed ^= _seed << 7;
+      _seed ^= _seed >> 9;
+      _seed ^= _seed << 8;
+      value += (int)(_seed % (2 * _noise + 1)) - _noise;
+
+      if(value < 0){
+        value = 0;
+      }
+      else if(value > 1023){
+        value = 1023;
+      }
+      return value;
+    }
+};
+
+
+/*
+  Subclass of class MappedPoti with simulated raw values.
+*/
+class SimMappedPoti : public MappedPoti {
+  private:
+    SimProfile _profile;
+
+  public:
+    SimMappedPoti(uint16_t channel)
+      : MappedPoti(0, channel % 16, channel % 9, channel % 4, 10 + channel % 90, channel % 21){
+      _profile.init(channel);
+    }
+
+    int getRawValue(){
+      return _profile.getValue(virtualMillis);
+    }
+};
+
+
+/*
+  Subclass of class CenteredPoti with simulated raw values.
+*/
+class SimCenteredPoti : public CenteredPoti {
+  private:
+    SimProfile _profile;
+
+  public:
+    SimCenteredPoti(uint16_t channel)
+      : CenteredPoti(0, channel % 16, channel % 9, channel % 4, 11 + 2 * (channel % 20), channel % 21, 20, 0){
+      _profile.init(channel);
+    }
+
+    int getRawValue(){
+      return _profile.getValue(virtualMillis);
+    }
+};
+
+
+SimMappedPoti* mappedPotis[NUM_CHANNELS / 2];
+SimCenteredPoti* centeredPotis[NUM_CHANNELS / 2];
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  // memory of the objects and pointers, without the management data of the heap
+  Serial.print("Byte per mapped channel=");
+  Serial.print(sizeof(SimMappedPoti) + sizeof(SimMappedPoti*));
+  Serial.print(", per centered channel=");
+  Serial.print(sizeof(SimCenteredPoti) + sizeof(SimCenteredPoti*));
+  Serial.print(", all channels=");
+  Serial.println((NUM_CHANNELS / 2) * (sizeof(SimMappedPoti) + sizeof(SimCenteredPoti)
+    + sizeof(SimMappedPoti*) + sizeof(SimCenteredPoti*)));
+
+  for(uint16_t i = 0 ; i < NUM_CHANNELS / 2 ; i++){
+    mappedPotis[i] = new SimMappedPoti(2 * i);
+    centeredPotis[i] = new SimCenteredPoti(2 * i + 1);
+  }
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  unsigned long mappedEvents = 0;
+  unsigned long centeredEvents = 0;
+  unsigned long startMicros, durationMicros;
+  double updates = (double)SIM_MILLIS * NUM_CHANNELS;
+
+  startMicros = micros();
+  for(uint16_t t = 0 ; t < SIM_MILLIS ; t++){
+    virtualMillis++;
+    for(uint16_t i = 0 ; i < NUM_CHANNELS / 2 ; i++){
+      if(mappedPotis[i]->hasChanged()){
+        mappedEvents++;
+      }
+      if(centeredPotis[i]->hasChanged()){
+        centeredEvents++;
+      }
+    }
+  }
+  durationMicros = micros() - startMicros;
+
+  Serial.print("channels=");
+  Serial.print(NUM_CHANNELS);
+  Serial.print(", simulated millis=");
+  Serial.print(SIM_MILLIS);
+  Serial.print(", duration micros=");
+  Serial.println(durationMicros);
+
+  Serial.print("channel updates per second=");
+  Serial.println(updates * 1000000.0 / durationMicros, 0);
+
+  Serial.print("mapped events per simulated second=");
+  Serial.print(mappedEvents * 1000.0 / SIM_MILLIS, 1);
+  Serial.print(", centered events per simulated second=");
+  Serial.println(centeredEvents * 1000.0 / SIM_MILLIS, 1);
+}
@@ -0,0 +1,242 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <CenteredPoti.h>
+#include <HalfShiftMappedPoti.h>
+
+/*
+  Example to generate the mapping tables in flash
+  memory (PROGMEM) for a list of MappedPoti,
+  CenteredPoti and HalfShiftMappedPoti configurations.
+
+  For each configuration of CONFIGS an object is
+  created and its table is calculated by the
+  function calcMappingTable(), so that the table
+  has exactly the mapping of hasChanged(). Each table
+  is verified for all analog values 0 to maxAnalogVal
+  against the calculated mapping of getMappings().
+  Only verified tables are written.
+
+  The output written to Serial is a header file with
+  a PROGMEM array and a function for setting the
+  table per configuration. The function accepts
+  only objects of the class of the configuration.
+  After copying the header into the sketch folder
+  (e.g. as MappingTables.h) the tables are used by
+
+  #include "MappingTables.h"
+  MappedPoti pot = MappedPoti(A7, 100, 0, 0, 10, 0);
+  setMAPPED_10_0_1023_Table(pot);
+
+  Then the mapping needs no floating point calculation
+  and no RAM except the pointer to the shared table.
+  The objects must be created with exactly the
+  parameters of the configuration (numMapping,
+  stretch, centerTol, centerVal and maxAnalogVal).
+
+  No potentiometer is necessary.
+*/
+
+#define TYPE_MAPPED 0
+#define TYPE_CENTERED 1
+#define TYPE_HALF_SHIFT 2
+
+/*
+  Mapping parameters of one configuration. centerTol and
+  centerVal are only used for CenteredPoti.
+*/
+struct TableConfig {
+  uint8_t type;
+  uint8_t numMapping;
+  uint8_t stretch;
+  uint8_t centerTol;
+  int centerVal;
+  int maxAnalogVal;
+};
+
+const TableConfig CONFIGS[] = {
+  {TYPE_MAPPED, 10, 0, 0, 0, 1023},
+  {TYPE_MAPPED, 25, 20, 0, 0, 1023},
+  {TYPE_CENTERED, 21, 0, 20, 0, 1023},
+  {TYPE_CENTERED, 11, 10, 30, 2047, 4095},
+  {TYPE_HALF_SHIFT, 10, 0, 0, 0, 1023}
+};
+
+#define NUM_CONFIGS (sizeof(CONFIGS) / sizeof(CONFIGS[0]))
+
+// table for the maximum number of internal mapping values (HalfShiftMappedPoti with 100)
+uint16_t table[198];
+
+
+// write the name of the table of a configuration
+void printName(const TableConfig& config){
+  if(config.type == TYPE_MAPPED){
+    Serial.print("MAPPED_");
+  }
+  else if(config.type == TYPE_CENTERED){
+    Serial.print("CENTERED_");
+  }
+  else{
+    Serial.print("HALF_SHIFT_");
+  }
+  Serial.print(config.numMapping);
+  Serial.print("_");
+  Serial.print(config.stretch);
+  if(config.type == TYPE_CENTERED){
+    Serial.print("_");
+    Serial.print(config.centerTol);
+    Serial.print("_");
+    Serial.print(config.centerVal);
+  }
+  Serial.print("_");
+  Serial.print(config.maxAnalogVal);
+}
+
+
+// mapping value of an analog value based on the table, independent of the search of the Poti classes
+uint8_t getTableMapping(int rawValue, uint8_t size){
+  uint8_t mapValue = 0;
+
+  while(mapValue < size && rawValue >= (int)table[mapValue]){
+    mapValue++;
+  }
+  return mapValue;
+}
+
+
+/*
+  Calculates and verifies the table of a configuration with
+  the object pot. Writes the table, if it is correct.
+*/
+template<class P>
+void generate(P& pot, const TableConfig& config, const char* className){
+  int rawValues[64];
+  uint8_t mapValues[64];
+#if !defined(__AVR__)
+  uint8_t tableMapValues[64];
+#endif
+  uint8_t size;
+  uint8_t mapValue;
+  unsigned long errors = 0;
+
+  pot.setMaxAnalogValue(config.maxAnalogVal);
+  size = pot.calcMappingTable(table);
+
+  Serial.print("\n// ");
+  Serial.print(className);
+  Serial.print(" numMapping ");
+  Serial.print(config.numMapping);
+  Serial.print(", stretch ");
+  Serial.print(config.stretch);
+  if(config.type == TYPE_CENTERED){
+    Serial.print(", centerTol ");
+    Serial.print(config.centerTol);
+    Serial.print(", centerVal ");
+    Serial.print(config.centerVal);
+  }
+  Serial.print(", maxAnalogVal ");
+  Serial.println(pot.getMaxAnalogValue());
+
+  if(size == 0){
+    Serial.println("// no table possible, mapping values are not ascending");
+    return;
+  }
+
+  // verification for all analog values
+  for(int i = 0 ; i <= pot.getMaxAnalogValue() ; i += 64){
+    for(int k = 0 ; k < 64 ; k++){
+      rawValues[k] = i + k;
+    }
+    pot.getMappings(rawValues, mapValues, 64);
+#if !defined(__AVR__)
+    // without AVR the flash memory is directly readable, so the table search of the class is verified too
+    pot.setMappingTable(table);
+    pot.getMappings(rawValues, tableMapValues, 64);
+    pot.setMappingTable(NULL);
+#endif
+    for(int k = 0 ; k < 64 && i + k <= pot.getMaxAnalogValue() ; k++){
+      mapValue = getTableMapping(i + k, size);
+      if(config.type == TYPE_HALF_SHIFT){
+        mapValue = (mapValue + 1) / 2;
+      }
+      if(mapValue != mapValues[k]){
+        errors++;
+      }
+#if !defined(__AVR__)
+      if(tableMapValues[k] != mapValues[k]){
+        errors++;
+      }
+#endif
+    }
+  }
+
+  if(errors > 0){
+    Serial.print("// verification failed, errors ");
+    Serial.println(errors);
+    return;
+  }
+
+  Serial.print("// verified for ");
+  Serial.print(pot.getMaxAnalogValue() + 1);
+  Serial.println(" analog values");
+  Serial.print("const uint16_t ");
+  printName(config);
+  Serial.print("[");
+  Serial.print(size);
+  Serial.print("] PROGMEM = {");
+  for(uint8_t i = 0 ; i < size ; i++){
+    if(i > 0){
+      Serial.print(",");
+    }
+    Serial.print(i % 16 == 0 ? "\n  " : " ");
+    Serial.print(table[i]);
+  }
+  Serial.println("\n};");
+
+  Serial.print("inline void set");
+  printName(config);
+  Serial.print("_Table(");
+  Serial.print(className);
+  Serial.print("& pot){ pot.setMappingTable(");
+  printName(config);
+  Serial.println("); }");
+}
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  Serial.println("// mapping tables generated by example MappingTables");
+  Serial.println("#ifndef MAPPING_TABLES");
+  Serial.println("#define MAPPING_TABLES");
+  Serial.println("\n#include <CenteredPoti.h>");
+  Serial.println("#include <HalfShiftMappedPoti.h>");
+
+  for(uint8_t i = 0 ; i < NUM_CONFIGS ; i++){
+    const TableConfig& config = CONFIGS[i];
+
+    if(config.type == TYPE_MAPPED){
+      MappedPoti pot = MappedPoti(0, 0, 0, 0, config.numMapping, config.stretch);
+      generate(pot, config, "MappedPoti");
+    }
+    else if(config.type == TYPE_CENTERED){
+      CenteredPoti pot = CenteredPoti(0, 0, 0, 0, config.numMapping, config.stretch, config.centerTol, config.centerVal);
+      generate(pot, config, "CenteredPoti");
+    }
+    else{
+      HalfShiftMappedPoti pot = HalfShiftMappedPoti(0, 0, 0, 0, config.numMapping, config.stretch);
+      generate(pot, config, "HalfShiftMappedPoti");
+    }
+  }
+
+  Serial.println("\n#endif");
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+}
@@ -0,0 +1,61 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <MultiMappedPoti.h>
+
+/*
+  Example to show several different mappings of
+  one potentiometer with only one measurement and
+  stabilization.
+
+  Output 0 maps the potentiometer to 10 values,
+  output 1 to 100 values and output 2 to a centered
+  range from -5 to +5. Each output has its own
+  change information, so only the changed outputs
+  are written.
+
+  Prerequisite is an potentiometer connected
+  with variable voltage pin to analog input
+  pin. Output will be written to Serial.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define READ_CYCLE_MILLIS 100         // minimum difference between two actual read of analog raw value
+#define ADD_RAW_AVG 4                 // additional measurements for building an avarage
+#define WEIGHT_PREV 8                 // weight of previous value in calculating new value
+
+MultiMappedPoti<3> pot = MultiMappedPoti<3>(INPUT_PIN, READ_CYCLE_MILLIS, WEIGHT_PREV, ADD_RAW_AVG);
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  // configuration of the outputs
+  pot.setMapping(0, 10, 0);
+  pot.setMapping(1, 100, 0);
+  pot.setCenteredMapping(2, 11, 0, 20, 0);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  // react on changing values by writing the relevant information
+  if(pot.hasChanged()){
+    if(pot.hasChanged(0)){
+      Serial.print("10 steps: ");
+      Serial.println(pot.getMappedValue(0));
+    }
+    if(pot.hasChanged(1)){
+      Serial.print("100 steps: ");
+      Serial.println(pot.getMappedValue(1));
+    }
+    if(pot.hasChanged(2)){
+      Serial.print("centered: ");
+      Serial.println(pot.getCenteredMappedValue(2));
+    }
+  }
+}
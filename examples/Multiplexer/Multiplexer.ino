@@ -0,0 +1,72 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <MuxPotiSource.h>
+#include <MappedPoti.h>
+
+/*
+  Example to show the usage of 16 potentiometers
+  connected by an analog multiplexer 74HC4067
+  to one analog input pin.
+
+  The multiplexer is scanned without waiting for
+  the settle time of the analog signal after
+  switching the address. The potentiometers are
+  handled by SourcedPoti<MappedPoti> objects, that
+  read the values of their multiplexer channel.
+
+  Prerequisite are potentiometers connected with
+  variable voltage pin to the channels of the
+  multiplexer, the signal pin of the multiplexer
+  connected to the analog input pin and the address
+  pins S0 to S3 connected to digital pins.
+  Output will be written to Serial.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define NUM_CHANNELS 16               // number of potentiometers on the multiplexer
+#define SETTLE_MICROS 10              // settle time after switching the multiplexer address
+#define NUM_MAP_VALUES 10             // max 100, raw values will be mapped to this number of mapping values
+#define READ_CYCLE_MILLIS 20          // minimum difference between two actual read of analog raw value
+
+const uint8_t ADDRESS_PINS[4] = {2, 3, 4, 5}; // S0, S1, S2, S3
+
+MuxPotiSource mux = MuxPotiSource(INPUT_PIN, ADDRESS_PINS, 4, NUM_CHANNELS, SETTLE_MICROS);
+
+SourcedPoti<MappedPoti>* pots[NUM_CHANNELS];
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  for(uint8_t i = 0 ; i < NUM_CHANNELS ; i++){
+    pots[i] = new SourcedPoti<MappedPoti>(&mux, i, READ_CYCLE_MILLIS, 0, 0, NUM_MAP_VALUES, 0);
+  }
+
+  // first measurement of all channels
+  mux.begin();
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  // next channel of the multiplexer, when settled
+  mux.update();
+
+  // react on changing values by writing the relevant information
+  for(uint8_t i = 0 ; i < NUM_CHANNELS ; i++){
+    if(pots[i]->hasChanged()){
+      Serial.print("channel=");
+      Serial.print(i);
+      Serial.print(", curVal=");
+      Serial.print(pots[i]->getValue());
+      Serial.print(", curMapVal=");
+      Serial.print(pots[i]->getMappedValue());
+      Serial.print("\n");
+    }
+  }
+}
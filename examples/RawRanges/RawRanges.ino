@@ -0,0 +1,76 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <CenteredPoti.h>
+#include <HalfShiftMappedPoti.h>
+
+/*
+  Example to show the ranges of analog values of all
+  mapping values of a MappedPoti, a CenteredPoti
+  and a HalfShiftMappedPoti.
+
+  The ranges are returned by getRawRangeForMapping()
+  with only few calculations per mapping value, e.g.
+  for the target of a motorized fader (middle of the
+  range) or for the positions of an LED ring. The
+  middle of each range is checked by getMappings().
+
+  No potentiometer is necessary.
+*/
+
+#define NUM_MAP_VALUES 11             // number of mapping values of all objects
+#define STRETCH 10                    // stretching of MappedPoti and CenteredPoti
+
+MappedPoti mappedPot = MappedPoti(0, 0, 0, 0, NUM_MAP_VALUES, STRETCH);
+CenteredPoti centeredPot = CenteredPoti(0, 0, 0, 0, NUM_MAP_VALUES, STRETCH, 40, 0);
+HalfShiftMappedPoti halfShiftPot = HalfShiftMappedPoti(0, 0, 0, 0, NUM_MAP_VALUES, 0);
+
+
+/*
+  Writes the ranges of all mapping values of the object pot and
+  checks the mapping value of the middle of each range.
+*/
+template<class P>
+void printRanges(P& pot, const char* className){
+  int low, high;
+  int target;
+  uint8_t mapValue;
+
+  Serial.print("\n");
+  Serial.println(className);
+  for(uint8_t k = 0 ; k < pot.getNumMappingValues() ; k++){
+    Serial.print("mapping ");
+    Serial.print(k);
+    if(!pot.getRawRangeForMapping(k, low, high)){
+      Serial.println(": not reached");
+      continue;
+    }
+    target = (low + high) / 2;
+    pot.getMappings(&target, &mapValue, 1);
+    Serial.print(": ");
+    Serial.print(low);
+    Serial.print(" to ");
+    Serial.print(high);
+    Serial.print(", target ");
+    Serial.print(target);
+    Serial.println(mapValue == k ? "" : " (wrong mapping)");
+  }
+}
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  printRanges(mappedPot, "MappedPoti");
+  printRanges(centeredPot, "CenteredPoti");
+  printRanges(halfShiftPot, "HalfShiftMappedPoti");
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+}
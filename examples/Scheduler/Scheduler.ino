@@ -0,0 +1,180 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+// virtual clock of the simulation, must be defined before including the Poti classes
+unsigned long virtualMillis = 1;
+#define POTI_MILLIS() virtualMillis
+
+#include <MappedPoti.h>
+#include <PotiScheduler.h>
+
+/*
+  Example for scheduling a big number of simulated
+  MappedPoti channels with different read cycles by
+  the PotiScheduler.
+
+  The loop is simulated with LOOPS_PER_MILLI loop runs
+  per millisecond on a virtual clock (defined by
+  POTI_MILLIS() before the include). First hasChanged()
+  of all channels is called in each loop run, then the
+  same simulation is done with poll() of the scheduler,
+  that calls hasChanged() only for the due channels,
+  and finally with a limit of MAX_READS_PER_POLL calls
+  per poll(). For all runs the number of hasChanged()
+  calls, the measurements, the maximum measurements of
+  one loop run, the changes and the duration are
+  written to Serial.
+
+  The number of measurements and changes is nearly the
+  same, but the scheduler reduces the calls and
+  staggers the first measurements of the channels over
+  their read cycles. Without the scheduler all channels
+  measure in the first millisecond and the channels
+  with the same read cycle stay together. The limit
+  bounds the measurements of a loop run.
+
+  No potentiometer is necessary.
+*/
+
+#if defined(__AVR__)
+#define NUM_CHANNELS 24               // number of simulated channels
+#else
+#define NUM_CHANNELS 256              // number of simulated channels
+#endif
+#define SIM_MILLIS 1000               // simulated milliseconds per run
+#define LOOPS_PER_MILLI 10            // loop runs per simulated millisecond
+#define MAX_READS_PER_POLL 4          // limit of hasChanged() calls per poll() of the last run
+
+// measurements of all channels
+unsigned long numReads = 0;
+
+
+/*
+  Subclass of class MappedPoti with a simulated knob, that is
+  turned slowly forth and back, and counted measurements.
+*/
+class SimMappedPoti : public MappedPoti {
+  private:
+    uint16_t _periodMillis;
+
+  public:
+    SimMappedPoti(uint16_t channel)
+      : MappedPoti(0, 5 + (channel * 7) % 46, 0, channel % 3, 20, 0){
+      _periodMillis = 400 + (channel * 37) % 1600;
+    }
+
+    int getRawValue(){
+      long value = (virtualMillis % _periodMillis) * 2048 / _periodMillis;
+
+      numReads++;
+      return (value > 1023 ? 2047 - value : value);
+    }
+};
+
+
+SimMappedPoti* potis[NUM_CHANNELS];
+PotiScheduler<NUM_CHANNELS> scheduler;
+
+
+// write the results of a run
+void printRun(const char* name, unsigned long calls, unsigned long maxReads,
+  unsigned long changes, unsigned long durationMicros){
+
+  Serial.print(name);
+  Serial.print(": hasChanged() calls=");
+  Serial.print(calls);
+  Serial.print(", measurements=");
+  Serial.print(numReads);
+  Serial.print(", max per loop run=");
+  Serial.print(maxReads);
+  Serial.print(", changes=");
+  Serial.print(changes);
+  Serial.print(", duration micros=");
+  Serial.println(durationMicros);
+}
+
+
+// start of a run with all channels in the initial state
+void resetChannels(){
+  for(uint16_t i = 0 ; i < NUM_CHANNELS ; i++){
+    potis[i]->reset();
+  }
+  numReads = 0;
+}
+
+
+// run with poll() of the scheduler in each loop run, same start of the knobs
+void runScheduler(const char* name, unsigned long startMillis){
+  unsigned long changes = 0;
+  unsigned long maxReads = 0;
+  unsigned long prevReads, startMicros;
+
+  virtualMillis = startMillis;
+  resetChannels();
+  scheduler.reschedule();
+  startMicros = micros();
+  for(uint16_t t = 0 ; t < SIM_MILLIS ; t++){
+    virtualMillis++;
+    for(uint8_t l = 0 ; l < LOOPS_PER_MILLI ; l++){
+      prevReads = numReads;
+      changes += scheduler.poll();
+      if(numReads - prevReads > maxReads){
+        maxReads = numReads - prevReads;
+      }
+    }
+  }
+  // each hasChanged() call of the scheduler is a measurement
+  printRun(name, numReads, maxReads, changes, micros() - startMicros);
+}
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  for(uint16_t i = 0 ; i < NUM_CHANNELS ; i++){
+    potis[i] = new SimMappedPoti(i);
+    scheduler.add(*potis[i]);
+  }
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  unsigned long calls = 0;
+  unsigned long changes = 0;
+  unsigned long maxReads = 0;
+  unsigned long startMillis, startMicros, prevReads;
+
+  // hasChanged() of all channels in each loop run
+  resetChannels();
+  startMillis = virtualMillis;
+  startMicros = micros();
+  for(uint16_t t = 0 ; t < SIM_MILLIS ; t++){
+    virtualMillis++;
+    for(uint8_t l = 0 ; l < LOOPS_PER_MILLI ; l++){
+      prevReads = numReads;
+      for(uint16_t i = 0 ; i < NUM_CHANNELS ; i++){
+        if(potis[i]->hasChanged()){
+          changes++;
+        }
+      }
+      calls += NUM_CHANNELS;
+      if(numReads - prevReads > maxReads){
+        maxReads = numReads - prevReads;
+      }
+    }
+  }
+  printRun("all channels", calls, maxReads, changes, micros() - startMicros);
+
+  // scheduler without and with limit
+  scheduler.setMaxReadsPerPoll(0);
+  runScheduler("scheduler", startMillis);
+  scheduler.setMaxReadsPerPoll(MAX_READS_PER_POLL);
+  runScheduler("scheduler with limit", startMillis);
+
+  virtualMillis += SIM_MILLIS;
+}
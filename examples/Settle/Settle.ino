@@ -0,0 +1,56 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <SettledPoti.h>
+
+/*
+  Example to separate the fast preview of the mapping
+  value from an expensive action, that shall be done
+  only once per turn of the potentiometer.
+
+  Each change of the mapping value is written at once
+  as preview. When the potentiometer has not been
+  turned for SETTLE_MILLIS milliseconds, the mapping
+  value is committed, e.g. for writing it to EEPROM.
+  The commit is only done, if the mapping value is
+  different to the last committed one.
+
+  Prerequisite is an potentiometer connected
+  with variable voltage pin to analog input
+  pin. Output will be written to Serial.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define NUM_MAP_VALUES 10             // max 100, raw values will be mapped to this number of mapping values
+#define READ_CYCLE_MILLIS 10          // minimum difference between two actual read of analog raw value
+#define WEIGHT_PREV 4                 // weight of previous value in calculating new value
+#define SETTLE_MILLIS 800             // milliseconds without change before the commit
+
+SettledPoti<MappedPoti> pot = SettledPoti<MappedPoti>(INPUT_PIN, READ_CYCLE_MILLIS, WEIGHT_PREV, 0, NUM_MAP_VALUES, 0);
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  pot.setSettleMillis(SETTLE_MILLIS);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  // fast feedback while turning
+  if(pot.hasChanged()){
+    Serial.print("preview curMapVal=");
+    Serial.println(pot.getMappedValue());
+  }
+
+  // expensive action once per turn
+  if(pot.hasSettled()){
+    Serial.print("commit settledMapVal=");
+    Serial.println(pot.getSettledMappedValue());
+  }
+}
@@ -0,0 +1,76 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <SnapshotPoti.h>
+
+/*
+  Example to read the values of a potentiometer
+  in an interrupt service routine (ISR).
+
+  A pulse at the interrupt pin (e.g. the clock
+  of a sequencer) triggers the ISR, which stores
+  the mapping value at this moment as value of
+  the next step. The ISR reads a consistent
+  snapshot of the values, even if it interrupts
+  hasChanged() in the loop, without disabling
+  the interrupts in the loop.
+
+  Prerequisite is an potentiometer connected
+  with variable voltage pin to analog input
+  pin and a pulse signal connected to the
+  interrupt pin. Output will be written to Serial.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define INTERRUPT_PIN 2               // must be a pin with external interrupt
+#define NUM_MAP_VALUES 16             // raw values will be mapped to this number of mapping values
+#define READ_CYCLE_MILLIS 10          // minimum difference between two actual read of analog raw value
+#define NUM_STEPS 8                   // number of stored steps
+
+SnapshotPoti<MappedPoti> pot = SnapshotPoti<MappedPoti>(INPUT_PIN, READ_CYCLE_MILLIS, 4, 0, NUM_MAP_VALUES, 0);
+
+// mapping values of the steps, written by the ISR
+volatile uint16_t steps[NUM_STEPS];
+// index of the next step, written by the ISR
+volatile uint8_t nextStep = 0;
+// index of the next step at the last output
+uint8_t printedStep = 0;
+
+
+// stores the current mapping value as next step
+void onPulse(){
+  PotiSnapshot snapshot;
+
+  pot.getSnapshot(snapshot);
+  steps[nextStep] = snapshot.mappedValue;
+  nextStep = (nextStep + 1) % NUM_STEPS;
+}
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  pinMode(INTERRUPT_PIN, INPUT);
+  attachInterrupt(digitalPinToInterrupt(INTERRUPT_PIN), onPulse, RISING);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  uint8_t step = nextStep;
+
+  // the values are only processed in the loop, the ISR uses the snapshots
+  pot.hasChanged();
+
+  if(step != printedStep){
+    Serial.print("step=");
+    Serial.print(printedStep);
+    Serial.print(", curMapVal=");
+    Serial.println(steps[printedStep]);
+    printedStep = (printedStep + 1) % NUM_STEPS;
+  }
+}
@@ -0,0 +1,71 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <SpiAdcPotiSource.h>
+#include <MappedPoti.h>
+
+/*
+  Example to show the usage of 8 potentiometers
+  connected to an external 12 bit A/D converter
+  MCP3208 with SPI interface.
+
+  All channels of the A/D converter are read in
+  one burst (one SPI transaction) per read cycle.
+  The potentiometers are handled by
+  SourcedPoti<MappedPoti> objects, that use the
+  values of their A/D converter channel. For the
+  MCP3008 (10 bit) use SPI_ADC_MCP3008.
+
+  Prerequisite are potentiometers connected with
+  variable voltage pin to the channels of the A/D
+  converter and the A/D converter connected to the
+  SPI pins and the chip select pin.
+  Output will be written to Serial.
+*/
+
+#define CS_PIN 10                     // chip select pin of the A/D converter
+#define NUM_CHANNELS 8                // number of potentiometers on the A/D converter
+#define NUM_MAP_VALUES 20             // max 100, raw values will be mapped to this number of mapping values
+#define READ_CYCLE_MILLIS 20          // minimum difference between two scans of the A/D converter
+
+SpiAdcPotiSource adc = SpiAdcPotiSource(CS_PIN, SPI_ADC_MCP3208, NUM_CHANNELS, READ_CYCLE_MILLIS);
+
+SourcedPoti<MappedPoti>* pots[NUM_CHANNELS];
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  for(uint8_t i = 0 ; i < NUM_CHANNELS ; i++){
+    // the source defines the read cycle, so the potis have no own read cycle
+    pots[i] = new SourcedPoti<MappedPoti>(&adc, i, 0, 0, 0, NUM_MAP_VALUES, 0);
+    pots[i]->setMaxAnalogValue(adc.getMaxAnalogValue());
+  }
+
+  // first scan of all channels
+  adc.begin();
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  // next scan of all channels, when read cycle is over
+  adc.update();
+
+  // react on changing values by writing the relevant information
+  for(uint8_t i = 0 ; i < NUM_CHANNELS ; i++){
+    if(pots[i]->hasChanged()){
+      Serial.print("channel=");
+      Serial.print(i);
+      Serial.print(", curVal=");
+      Serial.print(pots[i]->getValue());
+      Serial.print(", curMapVal=");
+      Serial.print(pots[i]->getMappedValue());
+      Serial.print("\n");
+    }
+  }
+}
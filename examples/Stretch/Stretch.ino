@@ -3,6 +3,7 @@
   under the MIT License (MIT)
 */
 
+#include <SharedPotiSource.h>
 #include <MappedPoti.h>
 
 /*
@@ -12,8 +13,11 @@
   compared in its consequences.
 
   In the example both Poti objects use the
-  same INPUT_PIN. This should normally
-  not be done, but is without problems possible.
+  same INPUT_PIN. They get their raw values
+  from a SharedPotiSource, so that both
+  objects share one analogRead() per
+  millisecond instead of reading the pin
+  independently.
 
   Prerequisite is an potentiometer connected
   with variable voltage pin to analog input
@@ -28,12 +32,15 @@
 #define WEIGHT_PREV 8                 // weight of previous value in calculating new value
 #define STRETCH 10                    // strength of stretching the map ranges
 
+// one conversion per millisecond for both Poti objects
+SharedPotiSource source = SharedPotiSource();
+
 // without stretching
-MappedPoti pot = MappedPoti(INPUT_PIN, READ_CYCLE_MILLIS, WEIGHT_PREV,
-                            ADD_RAW_AVG, NUM_MAP_VALUES, 0);
+SourcedPoti<MappedPoti> pot = SourcedPoti<MappedPoti>(&source, INPUT_PIN, READ_CYCLE_MILLIS,
+                            WEIGHT_PREV, ADD_RAW_AVG, NUM_MAP_VALUES, 0);
 // with stretching
-MappedPoti potStretch = MappedPoti(INPUT_PIN, READ_CYCLE_MILLIS, WEIGHT_PREV,
-                            ADD_RAW_AVG, NUM_MAP_VALUES, STRETCH);
+SourcedPoti<MappedPoti> potStretch = SourcedPoti<MappedPoti>(&source, INPUT_PIN, READ_CYCLE_MILLIS,
+                            WEIGHT_PREV, ADD_RAW_AVG, NUM_MAP_VALUES, STRETCH);
 
 // Status on or off independently of blinking
 boolean lightOn = false;
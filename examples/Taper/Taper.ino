@@ -0,0 +1,67 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <TaperedPoti.h>
+
+/*
+  Example to generate mapped values from
+  raw input of a logarithmical potentiometer.
+
+  The taper table in flash memory corrects the
+  logarithmical distribution of the analog values
+  (about 10% of the maximum value in the middle
+  position), so that each mapping value needs
+  the same movement of the potentiometer. The
+  breakpoints of the table can be found by
+  measuring the raw values at some positions of
+  the potentiometer.
+
+  Prerequisite is an logarithmical potentiometer
+  connected with variable voltage pin to analog
+  input pin. Output will be written to Serial.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define NUM_MAP_VALUES 10             // max 100, raw values will be mapped to this number of mapping values
+#define READ_CYCLE_MILLIS 100         // minimum difference between two actual read of analog raw value
+
+// pairs of raw value and corrected value, raw values ascending
+const uint16_t LOG_TAPER[] PROGMEM = {
+  0, 0,
+  30, 256,
+  102, 512,
+  400, 768,
+  1023, 1023
+};
+
+TaperedPoti pot = TaperedPoti(INPUT_PIN, READ_CYCLE_MILLIS, 0, 0, NUM_MAP_VALUES, LOG_TAPER, 5);
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+}
+
+
+// for showing relevant information
+void printValues(){
+  Serial.print("curVal=");
+  Serial.print(pot.getValue());
+  Serial.print(", taperedVal=");
+  Serial.print(pot.getTaperedValue());
+  Serial.print(", curMapVal=");
+  Serial.print(pot.getMappedValue());
+  Serial.print("\n");
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  // react on changing states by writing the relevant information
+  if(pot.hasChanged()){
+    printValues();
+  }
+}
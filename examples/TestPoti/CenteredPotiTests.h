@@ -8,10 +8,22 @@
 
 #include "Common.h"
 
+// mapping tables for 15 mapping values with center 444 to 580 and for 3 mapping values with center 501 to 521
+const uint16_t TEST_CENTERED_TABLE_15[] PROGMEM = {64, 127, 191, 254, 318, 381, 444, 581, 644, 707, 770, 834, 897, 960};
+const uint16_t TEST_CENTERED_TABLE_3[] PROGMEM = {501, 522};
+// unit table for 3 mapping values, e.g. in 0.1 dB
+const int16_t TEST_CENTERED_UNITS_3[] PROGMEM = {-60, 0, 32767};
+
 void doCenteredPotiTest(int id){  // ID_CENTEREDTEST = 4
   TestCenteredPoti poti0Wait(INPUT_PIN, 0, 0, 0, 25, 0, 81, 512);
+  TestCenteredPoti potiHyst(INPUT_PIN, 0, 0, 0, 3, 0, 10, 0);
   unsigned long startmicro = 0;
-  int seq, j;
+  int rawValues[64];
+  uint8_t mapValues[64];
+  uint8_t tableMapValues[64];
+  uint16_t table[14];
+  int16_t unitValue;
+  int seq, j, low, high;
   double x;
 
   seq = 0;
@@ -230,6 +242,118 @@ void doCenteredPotiTest(int id){  // ID_CENTEREDTEST = 4
   check(poti0Wait.getCenteredValue(),205,id,seq+48);
   check(poti0Wait.getCenteredMappedValue(),2,id,seq+49);
 
+  // now check mapping of value arrays
+
+  seq = 150;
+  poti0Wait.setMaxAnalogValue(1023);
+  poti0Wait.setNumMapping(15);
+  poti0Wait.setCenterValLow(444);
+  poti0Wait.setCenterValHigh(580);
+  poti0Wait.reset();
+  for(int i = 0 ; i < 1024 ; i += 64){
+    for(int k = 0 ; k < 64 ; k++){
+      rawValues[k] = i + k;
+    }
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+    for(int k = 0 ; k < 64 ; k++){
+      poti0Wait.setRawValue(i + k);
+      poti0Wait.hasChanged();
+      check(mapValues[k],poti0Wait.getMappedValue(),id,seq+1);
+    }
+  }
+
+  // now check mapping tables with the same mapping parameters
+
+  seq = 155;
+  check(poti0Wait.getMappingTableSize(),14,id,seq+1);
+  check(poti0Wait.calcMappingTable(table),14,id,seq+2);
+  for(int k = 0 ; k < 14 ; k++){
+    check(table[k],pgm_read_word(&TEST_CENTERED_TABLE_15[k]),id,seq+3);
+  }
+  poti0Wait.reset();
+  for(int i = 0 ; i < 1024 ; i += 64){
+    for(int k = 0 ; k < 64 ; k++){
+      rawValues[k] = i + k;
+    }
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+    poti0Wait.setMappingTable(TEST_CENTERED_TABLE_15);
+    poti0Wait.getMappings(rawValues, tableMapValues, 64);
+    for(int k = 0 ; k < 64 ; k++){
+      check(tableMapValues[k],mapValues[k],id,seq+4);
+      poti0Wait.setRawValue(i + k);
+      poti0Wait.hasChanged();
+      check(poti0Wait.getMappedValue(),mapValues[k],id,seq+5);
+    }
+    poti0Wait.setMappingTable(NULL);
+  }
+  check(potiHyst.calcMappingTable(table),2,id,seq+6);
+  check(table[0],501,id,seq+7);
+  check(table[1],522,id,seq+8);
+  potiHyst.setMappingTable(TEST_CENTERED_TABLE_3);
+
+  // now check hysteresis at the center 501 to 521
+
+  seq = 160;
+  potiHyst.setHysteresis(5);
+  potiHyst.setRawValue(530);
+  check(potiHyst.hasChanged(),true,id,seq+1);
+  check(potiHyst.getCenteredMappedValue(),1,id,seq+2);
+  potiHyst.setRawValue(518);
+  check(potiHyst.hasChanged(),false,id,seq+3);
+  check(potiHyst.getCenteredMappedValue(),1,id,seq+4);
+  potiHyst.setRawValue(515);
+  check(potiHyst.hasChanged(),true,id,seq+5);
+  check(potiHyst.getCenteredMappedValue(),0,id,seq+6);
+  potiHyst.setRawValue(525);
+  check(potiHyst.hasChanged(),false,id,seq+7);
+  potiHyst.setRawValue(497);
+  check(potiHyst.hasChanged(),false,id,seq+8);
+  potiHyst.setRawValue(495);
+  check(potiHyst.hasChanged(),true,id,seq+9);
+  check(potiHyst.getCenteredMappedValue(),-1,id,seq+10);
+  potiHyst.setMappingTable(NULL);
+
+  // now check unit table
+
+  seq = 170;
+  unitValue = 1;
+  check(potiHyst.getCenteredUnitValue(unitValue),false,id,seq+1);
+  check(unitValue,1,id,seq+2);
+  potiHyst.setUnitTable(TEST_CENTERED_UNITS_3);
+  check(potiHyst.getCenteredUnitValue(unitValue) && unitValue == -60,true,id,seq+3);
+  check(potiHyst.getCenteredUnitPrevValue(unitValue) && unitValue == 0,true,id,seq+4);
+  potiHyst.setRawValue(1000);
+  check(potiHyst.hasChanged(),true,id,seq+5);
+  // 1.0 in Q15 is a defined value
+  check(potiHyst.getCenteredUnitValue(unitValue) && unitValue == 32767,true,id,seq+6);
+  check(potiHyst.getCenteredUnitPrevValue(unitValue) && unitValue == -60,true,id,seq+7);
+  check(potiHyst.getUnitValueForMapping(1, unitValue) && unitValue == 0,true,id,seq+8);
+  check(potiHyst.getUnitValueForMapping(3, unitValue),false,id,seq+9);
+  potiHyst.reset();
+  check(potiHyst.getCenteredUnitValue(unitValue),false,id,seq+10);
+  check(potiHyst.getCenteredUnitPrevValue(unitValue),false,id,seq+11);
+  potiHyst.setRawValue(511);
+  check(potiHyst.hasChanged(),true,id,seq+12);
+  check(potiHyst.getCenteredUnitValue(unitValue) && unitValue == 0,true,id,seq+13);
+  potiHyst.setUnitTable(NULL);
+
+  // now check ranges of analog values of the mapping values with and without table
+
+  seq = 180;
+  for(int t = 0 ; t < 2 ; t++){
+    poti0Wait.setMappingTable(t == 0 ? NULL : TEST_CENTERED_TABLE_15);
+    for(uint8_t k = 0 ; k < 15 ; k++){
+      check(poti0Wait.getRawRangeForMapping(k, low, high),true,id,seq+1);
+      check(low,(k == 0 ? 0 : (int)pgm_read_word(&TEST_CENTERED_TABLE_15[k - 1])),id,seq+2);
+      check(high,(k == 14 ? 1023 : (int)pgm_read_word(&TEST_CENTERED_TABLE_15[k]) - 1),id,seq+3);
+    }
+    check(poti0Wait.getRawRangeForMapping(7, low, high),true,id,seq+4);
+    check(low,444,id,seq+5);
+    check(high,580,id,seq+6);
+    check(poti0Wait.getRawRangeForMapping(15, low, high),false,id,seq+7);
+  }
+  poti0Wait.setMappingTable(NULL);
+
   // performance
 
   Serial.println("\nPerformance Centered:");
@@ -261,6 +385,21 @@ void doCenteredPotiTest(int id){  // ID_CENTEREDTEST = 4
   }
   Serial.print(micros() - startmicro);
   Serial.println(" micros");
+
+  Serial.print("1024 * getMappings(), mapping 15: ");
+  poti0Wait.setMaxAnalogValue(1023);
+  poti0Wait.setNumMapping(15);
+  poti0Wait.setCenterValLow(444);
+  poti0Wait.setCenterValHigh(580);
+  for(int k = 0 ; k < 64 ; k++){
+    rawValues[k] = k * 16;
+  }
+  startmicro = micros();
+  for(int i = 0 ; i < 16 ; i++){
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
 }
 
 #endif
@@ -8,6 +8,21 @@
 
 #include "CenteredPoti.h"
 #include "HalfShiftMappedPoti.h"
+#include "StablePotiBank.h"
+#include "TaperedPoti.h"
+#include "MultiMappedPoti.h"
+#include "WideMappedPoti.h"
+#include "VelocityPoti.h"
+#include "TimestampedPoti.h"
+#include "SnapshotPoti.h"
+#include "HistoryPoti.h"
+#include "SettledPoti.h"
+#include "ThresholdPoti.h"
+#include "PotiScheduler.h"
+#include "PotiCollection.h"
+#include "MuxPotiSource.h"
+#include "SpiAdcPotiSource.h"
+#include "SharedPotiSource.h"
 
 /*
   Subclass of class Poti, that implements functionality for testing.
@@ -277,5 +292,289 @@ class TestCenteredPoti : public CenteredPoti {
     }
 };
 
-#endif
+/*
+  Subclass of class StablePotiBank, that implements functionality for testing.
+*/
+class TestStablePotiBank : public StablePotiBank<4> {
+  private:
+    int _internalValue[4];
+
+  public:
+    TestStablePotiBank(const uint8_t* inputPins, uint8_t readCycleMillis,
+                   uint8_t weightPrev, uint8_t addNumRawAvg)
+      : StablePotiBank<4>(inputPins, readCycleMillis, weightPrev, addNumRawAvg){};
+
+    int getRawValue(uint8_t channel){
+      return _internalValue[channel];
+    }
+
+    void setRawValue(uint8_t channel, int value){
+      _internalValue[channel] = value;
+    }
+};
+
+/*
+  Subclass of class TaperedPoti, that implements functionality for testing.
+*/
+class TestTaperedPoti : public TaperedPoti {
+  private:
+    int _internalValue;
+
+  public:
+    TestTaperedPoti(uint8_t inputPin, uint8_t readCycleMillis,
+                  uint8_t weightPrev, uint8_t addNumRawAvg,
+                  uint8_t numMapping, const uint16_t* taper, uint8_t numPoints)
+      : TaperedPoti(inputPin, readCycleMillis,
+                  weightPrev, addNumRawAvg,
+                  numMapping, taper, numPoints){};
+
+    int getRawValue(){
+      return _internalValue;
+    }
+
+    void setRawValue(int value){
+      _internalValue = value;
+    }
+
+    void setNumMapping(uint8_t numMapping){
+      _numMapping = numMapping;
+
+      if(_numMapping > 100){
+        _numMapping = 100;
+      }
 
+      if(_numMapping < 2){
+        _numMapping = 2;
+      }
+    }
+
+    void setTaper(const uint16_t* taper, uint8_t numPoints){
+      _taper = taper;
+      _numPoints = numPoints;
+      _segment = 0;
+    }
+};
+
+/*
+  Subclass of class MultiMappedPoti, that implements functionality for testing.
+*/
+class TestMultiMappedPoti : public MultiMappedPoti<3> {
+  private:
+    int _internalValue;
+
+  public:
+    TestMultiMappedPoti(uint8_t inputPin, uint8_t readCycleMillis,
+                  uint8_t weightPrev, uint8_t addNumRawAvg)
+      : MultiMappedPoti<3>(inputPin, readCycleMillis,
+                  weightPrev, addNumRawAvg){};
+
+    int getRawValue(){
+      return _internalValue;
+    }
+
+    void setRawValue(int value){
+      _internalValue = value;
+    }
+};
+
+/*
+  Subclass of class WideMappedPoti, that implements functionality for testing.
+*/
+class TestWideMappedPoti : public WideMappedPoti {
+  private:
+    int _internalValue;
+
+  public:
+    TestWideMappedPoti(uint8_t inputPin, uint8_t readCycleMillis,
+                  uint8_t weightPrev, uint8_t addNumRawAvg, uint16_t numMapping)
+      : WideMappedPoti(inputPin, readCycleMillis,
+                  weightPrev, addNumRawAvg, numMapping){};
+
+    int getRawValue(){
+      return _internalValue;
+    }
+
+    void setRawValue(int value){
+      _internalValue = value;
+    }
+};
+
+/*
+  Subclass of class TestStablePoti, that counts the raw value measurements.
+*/
+class TestCountingPoti : public TestStablePoti {
+  private:
+    unsigned int _numReads;
+
+  public:
+    TestCountingPoti(uint8_t inputPin, uint8_t readCycleMillis,
+                     uint8_t weightPrev, uint8_t addNumRawAvg)
+      : TestStablePoti(inputPin, readCycleMillis, weightPrev, addNumRawAvg){
+      _numReads = 0;
+    };
+
+    int getRawValue(){
+      _numReads++;
+      return TestStablePoti::getRawValue();
+    }
+
+    unsigned int getNumReads(){
+      return _numReads;
+    }
+
+    void clearNumReads(){
+      _numReads = 0;
+    }
+};
+
+/*
+  Subclass of class MuxPotiSource, that simulates a multiplexer for testing.
+*/
+class TestMuxPotiSource : public MuxPotiSource {
+  private:
+    int _simValues[16];
+    uint8_t _simAddress;
+    int _numPinWrites;
+
+  protected:
+    int readAnalogValue(){
+      return _simValues[_simAddress];
+    }
+
+    void writeAddressPin(uint8_t pin, uint8_t level){
+      for(uint8_t i = 0 ; i < _numAddressPins ; i++){
+        if(_addressPins[i] == pin){
+          _simAddress = (_simAddress & ~(1 << i)) | (level << i);
+        }
+      }
+      _numPinWrites++;
+    }
+
+  public:
+    TestMuxPotiSource(uint8_t analogPin, const uint8_t* addressPins,
+                  uint8_t numAddressPins, uint8_t numChannels, uint16_t settleMicros)
+      : MuxPotiSource(analogPin, addressPins, numAddressPins,
+                  numChannels, settleMicros){
+      for(uint8_t i = 0 ; i < 16 ; i++){
+        _simValues[i] = 0;
+      }
+      _simAddress = 0;
+      _numPinWrites = 0;
+    };
+
+    void setSimValue(uint8_t channel, int value){
+      _simValues[channel] = value;
+    }
+
+    int getNumPinWrites(){
+      return _numPinWrites;
+    }
+
+    void resetNumPinWrites(){
+      _numPinWrites = 0;
+    }
+};
+
+/*
+  Subclass of class SpiAdcPotiSource, that simulates a MCP3008 or
+  MCP3208 A/D converter for testing.
+*/
+class TestSpiAdcPotiSource : public SpiAdcPotiSource {
+  private:
+    int _simValues[8];
+    uint8_t _simByte;
+    uint8_t _simChannel;
+    int _numSelects;
+
+  protected:
+    uint8_t transfer(uint8_t data){
+      uint8_t result = 0;
+
+      if(_resolution == SPI_ADC_MCP3208){
+        if(_simByte == 0){
+          _simChannel = (data & 0x01) << 2;
+        }
+        else if(_simByte == 1){
+          _simChannel |= data >> 6;
+          result = (_simValues[_simChannel] >> 8) & 0x0F;
+        }
+        else{
+          result = _simValues[_simChannel] & 0xFF;
+        }
+      }
+      else{
+        if(_simByte == 1){
+          _simChannel = (data >> 4) & 0x07;
+          result = (_simValues[_simChannel] >> 8) & 0x03;
+        }
+        else if(_simByte == 2){
+          result = _simValues[_simChannel] & 0xFF;
+        }
+      }
+      _simByte++;
+      return result;
+    }
+
+    void selectChip(bool selected){
+      if(selected){
+        _simByte = 0;
+        _numSelects++;
+      }
+    }
+
+  public:
+    TestSpiAdcPotiSource(uint8_t csPin, uint8_t resolution,
+                  uint8_t numChannels, uint8_t readCycleMillis)
+      : SpiAdcPotiSource(csPin, resolution, numChannels, readCycleMillis){
+      for(uint8_t i = 0 ; i < 8 ; i++){
+        _simValues[i] = 0;
+      }
+      _simByte = 0;
+      _simChannel = 0;
+      _numSelects = 0;
+    };
+
+    void setSimValue(uint8_t channel, int value){
+      _simValues[channel] = value;
+    }
+
+    int getNumSelects(){
+      return _numSelects;
+    }
+};
+
+/*
+  Subclass of class SharedPotiSource with simulated analog values
+  and counting of the conversions.
+*/
+class TestSharedPotiSource : public SharedPotiSource {
+  private:
+    int _simValue;
+    int _numReads;
+
+  protected:
+    int readAnalogValue(uint8_t pin){
+      _numReads++;
+      return _simValue + pin;
+    }
+
+  public:
+    TestSharedPotiSource() : SharedPotiSource(){
+      _simValue = 0;
+      _numReads = 0;
+    };
+
+    void setSimValue(int value){
+      _simValue = value;
+    }
+
+    int getNumReads(){
+      return _numReads;
+    }
+
+    void resetNumReads(){
+      _numReads = 0;
+    }
+};
+
+#endif
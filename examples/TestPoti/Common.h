@@ -14,6 +14,21 @@
 #define ID_MAPPEDTEST 3
 #define ID_CENTEREDTEST 4
 #define ID_HALFSHIFTMAPPEDTEST 5
+#define ID_STABLEBANKTEST 6
+#define ID_TAPEREDTEST 7
+#define ID_MUXSOURCETEST 8
+#define ID_SPIADCSOURCETEST 9
+#define ID_SHAREDSOURCETEST 10
+#define ID_MULTIMAPPEDTEST 11
+#define ID_VELOCITYTEST 12
+#define ID_TIMESTAMPEDTEST 13
+#define ID_WIDEMAPPEDTEST 14
+#define ID_SNAPSHOTTEST 15
+#define ID_COLLECTIONTEST 16
+#define ID_HISTORYTEST 17
+#define ID_SETTLEDTEST 18
+#define ID_SCHEDULERTEST 19
+#define ID_THRESHOLDTEST 20
 #define INPUT_PIN A7                  // must be analog pin A0 to A7
 #define READ_CYCLE_MILLIS 100         // minimum difference between two actual read of analog raw value
 
@@ -33,6 +48,22 @@ void check(int value, int ref, int id, int seq){
   }
 }
 
+// timing tests with exact timestamps, all Poti classes use the virtual
+// clock (POTI_MILLIS()) from the given time on, 0 is not allowed
+void setVirtualMillis(unsigned long value){
+  virtualMillis = value;
+}
+
+// moves the virtual clock forward
+void addVirtualMillis(unsigned long value){
+  virtualMillis += value;
+}
+
+// all Poti classes use millis() again
+void useRealMillis(){
+  virtualMillis = 0;
+}
+
 // for showing value information
 void printValues(Poti* poti, bool newLine){
   Serial.print("curVal=");
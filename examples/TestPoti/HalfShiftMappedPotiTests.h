@@ -10,8 +10,11 @@
 
 void doHalfShiftMappedPotiTest(int id){  // ID_HALFSHIFTMAPPEDTEST = 5
   TestHalfShiftMappedPoti poti0Wait(INPUT_PIN, 0, 0, 0, 20, 0);
+  TestHalfShiftMappedPoti potiHyst(INPUT_PIN, 0, 0, 0, 3, 0);
   unsigned long startmicro = 0;
-  int seq, j;
+  int rawValues[64];
+  uint8_t mapValues[64];
+  int seq, j, low, high;
   double x;
 
   seq = 0;
@@ -113,6 +116,59 @@ void doHalfShiftMappedPotiTest(int id){  // ID_HALFSHIFTMAPPEDTEST = 5
     check(poti0Wait.hasChanged(),false,id,seq+12);
   }
 
+  // now check mapping of value arrays
+
+  seq = 80;
+  poti0Wait.setMaxAnalogValue(1023);
+  poti0Wait.setNumMapping(25);
+  poti0Wait.setStretch(20);
+  poti0Wait.reset();
+  for(int i = 0 ; i < 1024 ; i += 64){
+    for(int k = 0 ; k < 64 ; k++){
+      rawValues[k] = i + k;
+    }
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+    for(int k = 0 ; k < 64 ; k++){
+      poti0Wait.setRawValue(i + k);
+      poti0Wait.hasChanged();
+      check(mapValues[k],poti0Wait.getMappedValue(),id,seq+1);
+    }
+  }
+
+  // now check hysteresis at the mapping boundaries 256 and 768
+
+  seq = 90;
+  potiHyst.setHysteresis(8);
+  potiHyst.setRawValue(250);
+  check(potiHyst.hasChanged(),true,id,seq+1);
+  check(potiHyst.getMappedValue(),0,id,seq+2);
+  potiHyst.setRawValue(260);
+  check(potiHyst.hasChanged(),false,id,seq+3);
+  potiHyst.setRawValue(264);
+  check(potiHyst.hasChanged(),true,id,seq+4);
+  check(potiHyst.getMappedValue(),1,id,seq+5);
+  potiHyst.setRawValue(600);
+  check(potiHyst.hasChanged(),false,id,seq+6);
+  potiHyst.setRawValue(250);
+  check(potiHyst.hasChanged(),false,id,seq+7);
+  potiHyst.setRawValue(247);
+  check(potiHyst.hasChanged(),true,id,seq+8);
+  check(potiHyst.getMappedValue(),0,id,seq+9);
+
+  // now check ranges of analog values of the mapping values
+
+  seq = 100;
+  check(potiHyst.getRawRangeForMapping(0, low, high),true,id,seq+1);
+  check(low,0,id,seq+2);
+  check(high,255,id,seq+3);
+  check(potiHyst.getRawRangeForMapping(1, low, high),true,id,seq+4);
+  check(low,256,id,seq+5);
+  check(high,767,id,seq+6);
+  check(potiHyst.getRawRangeForMapping(2, low, high),true,id,seq+7);
+  check(low,768,id,seq+8);
+  check(high,1023,id,seq+9);
+  check(potiHyst.getRawRangeForMapping(3, low, high),false,id,seq+10);
+
   // performance
 
   Serial.println("\nPerformance HalfShiftMapping:");
@@ -168,6 +224,20 @@ void doHalfShiftMappedPotiTest(int id){  // ID_HALFSHIFTMAPPEDTEST = 5
   }
   Serial.print(micros() - startmicro);
   Serial.println(" micros");
+
+  Serial.print("1024 * getMappings(), stretch 20, mapping 25: ");
+  poti0Wait.setMaxAnalogValue(1023);
+  poti0Wait.setNumMapping(25);
+  poti0Wait.setStretch(20);
+  for(int k = 0 ; k < 64 ; k++){
+    rawValues[k] = k * 16;
+  }
+  startmicro = micros();
+  for(int i = 0 ; i < 16 ; i++){
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
 }
 
 #endif
@@ -0,0 +1,121 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef HISTORYPOTITESTS_TESTPOTI
+#define HISTORYPOTITESTS_TESTPOTI
+
+#include "Common.h"
+
+void doHistoryPotiTest(int id){  // ID_HISTORYTEST = 17
+  HistoryPoti<TestMappedPoti, 4> mappedPoti(INPUT_PIN, 0, 0, 0, 10, 0);
+  HistoryPoti<TestPoti, 3> poti(INPUT_PIN, 0);
+  unsigned long startmicro = 0;
+  long sum = 0;
+  int seq = 0;
+
+  // empty history
+  check(mappedPoti.getHistoryNum(),0,id,seq+1);
+  check(mappedPoti.getHistoryValue(0),POTI_VALUE_UNDEFINED,id,seq+2);
+  check(mappedPoti.getHistoryMappedValue(0),POTI_MAPPING_UNDEFINED,id,seq+3);
+  check(mappedPoti.getHistoryMillis(0),0,id,seq+4);
+  check(mappedPoti.getHistoryMin(4, false),POTI_VALUE_UNDEFINED,id,seq+5);
+  check(mappedPoti.getHistoryAverage(4, true),POTI_VALUE_UNDEFINED,id,seq+6);
+
+  // only changes are stored, oldest entries are overwritten
+  seq = 10;
+  mappedPoti.setRawValue(150);
+  check(mappedPoti.hasChanged(),true,id,seq+1);
+  mappedPoti.setRawValue(160);
+  check(mappedPoti.hasChanged(),false,id,seq+2);
+  check(mappedPoti.getHistoryNum(),1,id,seq+3);
+  mappedPoti.setRawValue(350);
+  mappedPoti.hasChanged();
+  mappedPoti.setRawValue(900);
+  mappedPoti.hasChanged();
+  mappedPoti.setRawValue(50);
+  mappedPoti.hasChanged();
+  mappedPoti.setRawValue(550);
+  mappedPoti.hasChanged();
+  check(mappedPoti.getHistoryNum(),4,id,seq+4);
+  check(mappedPoti.getHistoryValue(0),550,id,seq+5);
+  check(mappedPoti.getHistoryValue(1),50,id,seq+6);
+  check(mappedPoti.getHistoryValue(2),900,id,seq+7);
+  check(mappedPoti.getHistoryValue(3),350,id,seq+8);
+  check(mappedPoti.getHistoryValue(4),POTI_VALUE_UNDEFINED,id,seq+9);
+  check(mappedPoti.getHistoryMappedValue(0),mappedPoti.getMappedValue(),id,seq+10);
+  check(mappedPoti.getHistoryMappedValue(1),mappedPoti.getMappedPrevValue(),id,seq+11);
+  check(mappedPoti.getHistoryMappedValue(2),8,id,seq+12);
+  check(mappedPoti.getHistoryMappedValue(3),3,id,seq+13);
+  check(mappedPoti.getHistoryMillis(0) >= mappedPoti.getHistoryMillis(3),true,id,seq+14);
+
+  // minimum, maximum and average of the last entries
+  seq = 30;
+  check(mappedPoti.getHistoryMin(4, false),50,id,seq+1);
+  check(mappedPoti.getHistoryMax(4, false),900,id,seq+2);
+  check(mappedPoti.getHistoryAverage(4, false),463,id,seq+3);
+  check(mappedPoti.getHistoryAverage(10, false),463,id,seq+4);
+  check(mappedPoti.getHistoryMin(2, true),0,id,seq+5);
+  check(mappedPoti.getHistoryMax(2, true),5,id,seq+6);
+  check(mappedPoti.getHistoryAverage(3, true),4,id,seq+7);
+  check(mappedPoti.getHistoryMax(1, false),550,id,seq+8);
+  check(mappedPoti.getHistoryMin(0, false),POTI_VALUE_UNDEFINED,id,seq+9);
+
+  // time windows
+  seq = 40;
+  setVirtualMillis(1000);
+  mappedPoti.reset();
+  check(mappedPoti.getHistoryNum(),0,id,seq+1);
+  mappedPoti.setRawValue(100);
+  check(mappedPoti.hasChanged(),true,id,seq+2);
+  addVirtualMillis(50);
+  mappedPoti.setRawValue(600);
+  check(mappedPoti.hasChanged(),true,id,seq+3);
+  check(mappedPoti.getHistoryNum(49),1,id,seq+4);
+  check(mappedPoti.getHistoryNum(50),2,id,seq+5);
+  check(mappedPoti.getHistoryMillis(0) == 1050,true,id,seq+6);
+  check(mappedPoti.getHistoryMillis(1) == 1000,true,id,seq+7);
+  check(mappedPoti.getHistoryMax(mappedPoti.getHistoryNum(20), false),600,id,seq+8);
+  // window of the current time
+  addVirtualMillis(10);
+  check(mappedPoti.getHistoryNum(9),0,id,seq+9);
+  check(mappedPoti.getHistoryNum(10),1,id,seq+10);
+  useRealMillis();
+
+  // class without mapping
+  seq = 50;
+  poti.setRawValue(10);
+  poti.hasChanged();
+  poti.setRawValue(20);
+  poti.hasChanged();
+  check(poti.getHistoryNum(),2,id,seq+1);
+  check(poti.getHistoryValue(1),10,id,seq+2);
+  check(poti.getHistoryMappedValue(0),POTI_MAPPING_UNDEFINED,id,seq+3);
+  check(poti.getHistoryAverage(2, false),15,id,seq+4);
+
+  // performance
+
+  Serial.println("\nPerformance History:");
+
+  Serial.print("1024 * hasChanged(): ");
+  mappedPoti.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    mappedPoti.setRawValue(i);
+    mappedPoti.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * getHistoryAverage() of 4 entries: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    sum += mappedPoti.getHistoryAverage(4, false);
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+  check(sum > 0,true,id,seq+5);
+}
+
+#endif
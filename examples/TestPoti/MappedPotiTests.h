@@ -8,10 +8,20 @@
 
 #include "Common.h"
 
+// mapping table for 8 mapping values, stretch 10 and maxAnalogVal 1023
+const uint16_t TEST_MAPPING_TABLE_8_10[] PROGMEM = {40, 103, 220, 512, 804, 921, 984};
+
 void doMappedPotiTest(int id){  // ID_MAPPEDTEST = 3
   TestMappedPoti poti0Wait(INPUT_PIN, 0, 0, 0, 20, 0);
   unsigned long startmicro = 0;
-  int seq, j;
+  int rawValues[64];
+  uint8_t mapValues[64];
+  uint8_t tableMapValues[64];
+  uint16_t table[7];
+  int rangeValues[4];
+  uint8_t rangeMapValues[4];
+  const uint8_t rangeNumMapping[] = {2, 5, 10, 25, 100};
+  int seq, j, low, high;
   double x;
 
   seq = 0;
@@ -191,6 +201,145 @@ void doMappedPotiTest(int id){  // ID_MAPPEDTEST = 3
   check(poti0Wait.getValue(),972,id,seq+23);
   check(poti0Wait.getMappedValue(),3,id,seq+24);
 
+  // now check mapping of value arrays
+
+  seq = 140;
+  poti0Wait.setMaxAnalogValue(1023);
+  poti0Wait.setNumMapping(25);
+  poti0Wait.setStretch(20);
+  poti0Wait.reset();
+  for(int i = 0 ; i < 1024 ; i += 64){
+    for(int k = 0 ; k < 64 ; k++){
+      rawValues[k] = i + k;
+    }
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+    for(int k = 0 ; k < 64 ; k++){
+      poti0Wait.setRawValue(i + k);
+      poti0Wait.hasChanged();
+      check(mapValues[k],poti0Wait.getMappedValue(),id,seq+1);
+    }
+  }
+
+  // now check hysteresis at the mapping boundaries 256, 512 and 768
+
+  seq = 150;
+  poti0Wait.setNumMapping(4);
+  poti0Wait.setStretch(0);
+  poti0Wait.setHysteresis(10);
+  poti0Wait.reset();
+  poti0Wait.setRawValue(250);
+  check(poti0Wait.hasChanged(),true,id,seq+1);
+  check(poti0Wait.getMappedValue(),0,id,seq+2);
+  poti0Wait.setRawValue(260);
+  check(poti0Wait.hasChanged(),false,id,seq+3);
+  check(poti0Wait.getMappedValue(),0,id,seq+4);
+  poti0Wait.setRawValue(266);
+  check(poti0Wait.hasChanged(),true,id,seq+5);
+  check(poti0Wait.getMappedValue(),1,id,seq+6);
+  poti0Wait.setRawValue(250);
+  check(poti0Wait.hasChanged(),false,id,seq+7);
+  check(poti0Wait.getMappedValue(),1,id,seq+8);
+  poti0Wait.setRawValue(245);
+  check(poti0Wait.hasChanged(),true,id,seq+9);
+  check(poti0Wait.getMappedValue(),0,id,seq+10);
+  poti0Wait.setRawValue(1023);
+  check(poti0Wait.hasChanged(),true,id,seq+11);
+  check(poti0Wait.getMappedValue(),3,id,seq+12);
+  poti0Wait.setRawValue(770);
+  check(poti0Wait.hasChanged(),false,id,seq+13);
+  poti0Wait.setRawValue(0);
+  check(poti0Wait.hasChanged(),true,id,seq+14);
+  check(poti0Wait.getMappedValue(),0,id,seq+15);
+  poti0Wait.setHysteresis(0);
+
+  // now check mapping tables
+
+  seq = 170;
+  poti0Wait.setNumMapping(8);
+  poti0Wait.setStretch(10);
+  poti0Wait.reset();
+  check(poti0Wait.getMappingTableSize(),7,id,seq+1);
+  check(poti0Wait.calcMappingTable(table),7,id,seq+2);
+  for(int k = 0 ; k < 7 ; k++){
+    check(table[k],pgm_read_word(&TEST_MAPPING_TABLE_8_10[k]),id,seq+3);
+  }
+  for(int i = 0 ; i < 1024 ; i += 64){
+    for(int k = 0 ; k < 64 ; k++){
+      rawValues[k] = i + k;
+    }
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+    poti0Wait.setMappingTable(TEST_MAPPING_TABLE_8_10);
+    poti0Wait.getMappings(rawValues, tableMapValues, 64);
+    for(int k = 0 ; k < 64 ; k++){
+      check(tableMapValues[k],mapValues[k],id,seq+4);
+      poti0Wait.setRawValue(i + k);
+      poti0Wait.hasChanged();
+      check(poti0Wait.getMappedValue(),mapValues[k],id,seq+5);
+    }
+    poti0Wait.setMappingTable(NULL);
+  }
+
+  seq = 180;
+  poti0Wait.setMappingTable(TEST_MAPPING_TABLE_8_10);
+  poti0Wait.reset();
+  poti0Wait.setRawValue(39);
+  check(poti0Wait.hasChanged(),true,id,seq+1);
+  check(poti0Wait.getMappedValue(),0,id,seq+2);
+  poti0Wait.setRawValue(40);
+  check(poti0Wait.hasChanged(),true,id,seq+3);
+  check(poti0Wait.getMappedValue(),1,id,seq+4);
+  poti0Wait.setRawValue(983);
+  check(poti0Wait.hasChanged(),true,id,seq+5);
+  check(poti0Wait.getMappedValue(),6,id,seq+6);
+  poti0Wait.setRawValue(1023);
+  check(poti0Wait.hasChanged(),true,id,seq+7);
+  check(poti0Wait.getMappedValue(),7,id,seq+8);
+  poti0Wait.setMappingTable(NULL);
+  poti0Wait.setNumMapping(2);
+  poti0Wait.setStretch(0);
+  check(poti0Wait.getMappingTableSize(),1,id,seq+9);
+  check(poti0Wait.calcMappingTable(table),1,id,seq+10);
+  check(table[0],512,id,seq+11);
+
+  // now check ranges of analog values of the mapping values with and without table
+
+  seq = 190;
+  poti0Wait.setNumMapping(8);
+  poti0Wait.setStretch(10);
+  for(int t = 0 ; t < 2 ; t++){
+    poti0Wait.setMappingTable(t == 0 ? NULL : TEST_MAPPING_TABLE_8_10);
+    for(uint8_t k = 0 ; k < 8 ; k++){
+      check(poti0Wait.getRawRangeForMapping(k, low, high),true,id,seq+1);
+      check(low,(k == 0 ? 0 : (int)pgm_read_word(&TEST_MAPPING_TABLE_8_10[k - 1])),id,seq+2);
+      check(high,(k == 7 ? 1023 : (int)pgm_read_word(&TEST_MAPPING_TABLE_8_10[k]) - 1),id,seq+3);
+    }
+    check(poti0Wait.getRawRangeForMapping(8, low, high),false,id,seq+4);
+  }
+  poti0Wait.setMappingTable(NULL);
+
+  // boundaries of the ranges for different mapping parameters
+
+  seq = 195;
+  for(uint8_t n = 0 ; n < 5 ; n++){
+    for(uint8_t stretch = 0 ; stretch <= 20 ; stretch += 10){
+      poti0Wait.setNumMapping(rangeNumMapping[n]);
+      poti0Wait.setStretch(stretch);
+      for(uint8_t k = 0 ; k < poti0Wait.getNumMappingValues() ; k++){
+        if(poti0Wait.getRawRangeForMapping(k, low, high)){
+          rangeValues[0] = (low > 0 ? low - 1 : 0);
+          rangeValues[1] = low;
+          rangeValues[2] = high;
+          rangeValues[3] = (high < 1023 ? high + 1 : 1023);
+          poti0Wait.getMappings(rangeValues, rangeMapValues, 4);
+          check(low == 0 || rangeMapValues[0] < k,true,id,seq+1);
+          check(rangeMapValues[1],k,id,seq+2);
+          check(rangeMapValues[2],k,id,seq+3);
+          check(high == 1023 || rangeMapValues[3] > k,true,id,seq+4);
+        }
+      }
+    }
+  }
+
   // performance
 
   Serial.println("\nPerformance Mapping:");
@@ -246,6 +395,43 @@ void doMappedPotiTest(int id){  // ID_MAPPEDTEST = 3
   }
   Serial.print(micros() - startmicro);
   Serial.println(" micros");
+
+  Serial.print("1024 * hasChanged(), stretch 10, mapping  8, table: ");
+  poti0Wait.setMaxAnalogValue(1023);
+  poti0Wait.setNumMapping(8);
+  poti0Wait.setStretch(10);
+  poti0Wait.setMappingTable(TEST_MAPPING_TABLE_8_10);
+  poti0Wait.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    poti0Wait.setRawValue(i);
+    poti0Wait.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+  poti0Wait.setMappingTable(NULL);
+
+  Serial.print("1024 * getRawRangeForMapping(), stretch 10, mapping  8: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    poti0Wait.getRawRangeForMapping(i & 0x07, low, high);
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * getMappings(), stretch 20, mapping 25: ");
+  poti0Wait.setMaxAnalogValue(1023);
+  poti0Wait.setNumMapping(25);
+  poti0Wait.setStretch(20);
+  for(int k = 0 ; k < 64 ; k++){
+    rawValues[k] = k * 16;
+  }
+  startmicro = micros();
+  for(int i = 0 ; i < 16 ; i++){
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
 }
 
 #endif
@@ -0,0 +1,186 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef MULTIMAPPEDPOTITESTS_TESTPOTI
+#define MULTIMAPPEDPOTITESTS_TESTPOTI
+
+#include "Common.h"
+
+// compare all outputs with single MappedPoti, CenteredPoti and HalfShiftMappedPoti objects
+void checkMultiMappedPoti(uint8_t weightPrev, uint8_t addNumRawAvg, uint8_t stretch,
+                          uint8_t hysteresis, int id, int seq){
+  TestMultiMappedPoti multi(INPUT_PIN, 0, weightPrev, addNumRawAvg);
+  TestMappedPoti mapped(INPUT_PIN, 0, weightPrev, addNumRawAvg, 10, stretch);
+  TestCenteredPoti centered(INPUT_PIN, 0, weightPrev, addNumRawAvg, 21, stretch, 15, 500);
+  TestHalfShiftMappedPoti halfShift(INPUT_PIN, 0, weightPrev, addNumRawAvg, 11, stretch);
+  bool changed, potiChanged, anyChanged;
+  int value;
+
+  multi.setMapping(0, 10, stretch);
+  multi.setCenteredMapping(1, 21, stretch, 15, 500);
+  multi.setHalfShiftMapping(2, 11, stretch);
+  multi.setHysteresis(hysteresis);
+  mapped.setHysteresis(hysteresis);
+  centered.setHysteresis(hysteresis);
+  halfShift.setHysteresis(hysteresis);
+  check(multi.getNumOutputs(),3,id,seq+1);
+  check(multi.getNumMappingValues(0),mapped.getNumMappingValues(),id,seq+1);
+  check(multi.getNumMappingValues(1),centered.getNumMappingValues(),id,seq+1);
+  check(multi.getNumMappingValues(2),halfShift.getNumMappingValues(),id,seq+1);
+
+  for(int i = 0 ; i < 200 ; i++){
+    // ensures that every object measures in this step
+    delay(1);
+    value = (i < 100 ? (i * 97 + (i & 0x03) * 5) % 1024 : 300 + (i * 7) % 200);
+    multi.setRawValue(value);
+    mapped.setRawValue(value);
+    centered.setRawValue(value);
+    halfShift.setRawValue(value);
+    changed = multi.hasChanged();
+
+    potiChanged = mapped.hasChanged();
+    anyChanged = potiChanged;
+    check(multi.hasChanged(0),potiChanged,id,seq+2);
+    check(multi.getOutputValue(0),mapped.getValue(),id,seq+3);
+    check(multi.getOutputPrevValue(0),mapped.getPrevValue(),id,seq+3);
+    check(multi.getMappedValue(0),mapped.getMappedValue(),id,seq+4);
+    check(multi.getMappedPrevValue(0),mapped.getMappedPrevValue(),id,seq+4);
+
+    potiChanged = centered.hasChanged();
+    anyChanged = anyChanged || potiChanged;
+    check(multi.hasChanged(1),potiChanged,id,seq+5);
+    check(multi.getOutputValue(1),centered.getValue(),id,seq+6);
+    check(multi.getOutputPrevValue(1),centered.getPrevValue(),id,seq+6);
+    check(multi.getCenteredMappedValue(1),centered.getCenteredMappedValue(),id,seq+7);
+    check(multi.getCenteredMappedPrevValue(1),centered.getCenteredMappedPrevValue(),id,seq+7);
+
+    potiChanged = halfShift.hasChanged();
+    anyChanged = anyChanged || potiChanged;
+    check(multi.hasChanged(2),potiChanged,id,seq+8);
+    check(multi.getOutputValue(2),halfShift.getValue(),id,seq+9);
+    check(multi.getMappedValue(2),halfShift.getMappedValue(),id,seq+9);
+
+    check(changed,anyChanged,id,seq+10);
+    for(uint8_t k = 0 ; k < 3 ; k++){
+      if(multi.hasChanged(k)){
+        check(multi.getValue(),multi.getOutputValue(k),id,seq+10);
+      }
+    }
+  }
+}
+
+void doMultiMappedPotiTest(int id){  // ID_MULTIMAPPEDTEST = 11
+  TestMultiMappedPoti multi(INPUT_PIN, 0, 0, 0);
+  TestMappedPoti mapped10(INPUT_PIN, 0, 0, 0, 10, 0);
+  TestMappedPoti mapped100(INPUT_PIN, 0, 0, 0, 100, 0);
+  TestCenteredPoti centered(INPUT_PIN, 0, 0, 0, 11, 0, 10, 0);
+  unsigned long startmicro = 0;
+  int seq = 0;
+
+  // default and corrected configurations
+  check(multi.getNumMappingValues(0),2,id,seq+1);
+  multi.setMapping(0, 1, 30);
+  check(multi.getNumMappingValues(0),2,id,seq+2);
+  multi.setMapping(0, 120, 0);
+  check(multi.getNumMappingValues(0),100,id,seq+3);
+  multi.setCenteredMapping(1, 10, 0, 30, 0);
+  check(multi.getNumMappingValues(1),11,id,seq+4);
+  multi.setHalfShiftMapping(2, 11, 0);
+  check(multi.getNumMappingValues(2),11,id,seq+5);
+  check(multi.getOutputValue(0),POTI_VALUE_UNDEFINED,id,seq+6);
+  check(multi.getMappedValue(0),POTI_MAPPING_UNDEFINED,id,seq+7);
+
+  // change information per output
+  seq = 10;
+  multi.setRawValue(512);
+  check(multi.hasChanged(),true,id,seq+1);
+  check(multi.hasChanged(0),true,id,seq+2);
+  check(multi.hasChanged(1),true,id,seq+3);
+  check(multi.getMappedValue(0),50,id,seq+4);
+  check(multi.getCenteredMappedValue(1),0,id,seq+5);
+  multi.setRawValue(525);
+  check(multi.hasChanged(),true,id,seq+6);
+  check(multi.hasChanged(0),true,id,seq+7);
+  check(multi.hasChanged(1),false,id,seq+8);
+  check(multi.getOutputValue(0),525,id,seq+9);
+  check(multi.getOutputPrevValue(0),512,id,seq+10);
+  check(multi.getOutputValue(1),512,id,seq+11);
+  check(multi.getValue(),525,id,seq+11);
+  check(multi.getPrevValue(),512,id,seq+11);
+  check(multi.hasChanged(),false,id,seq+12);
+  check(multi.hasChanged(0),false,id,seq+13);
+  multi.reset();
+  check(multi.getOutputValue(0),POTI_VALUE_UNDEFINED,id,seq+14);
+  check(multi.getValue(),POTI_VALUE_UNDEFINED,id,seq+14);
+  check(multi.getNumMappingValues(0),100,id,seq+15);
+
+  // identical values as single objects for all stabilization methods
+  checkMultiMappedPoti(0, 0, 0, 0, id, 20);
+  checkMultiMappedPoti(4, 0, 5, 0, id, 40);
+  checkMultiMappedPoti(0, 2, 10, 0, id, 60);
+  checkMultiMappedPoti(12, 7, 20, 0, id, 80);
+  checkMultiMappedPoti(0, 0, 0, 8, id, 100);
+  checkMultiMappedPoti(4, 1, 10, 20, id, 120);
+
+  // 12 bit analog values
+  seq = 140;
+  check(multi.setMaxAnalogValue(4095),4095,id,seq+1);
+  multi.setMapping(0, 10, 0);
+  multi.setRawValue(4095);
+  check(multi.hasChanged(),true,id,seq+2);
+  check(multi.getMappedValue(0),9,id,seq+3);
+
+  // usable with the wrapper templates like every other Poti
+  seq = 150;
+  SnapshotPoti<TestMultiMappedPoti> snapshotMulti(INPUT_PIN, 0, 0, 0);
+  HistoryPoti<TestMultiMappedPoti, 2> historyMulti(INPUT_PIN, 0, 0, 0);
+  PotiSnapshot snapshot;
+  snapshotMulti.setRawValue(700);
+  check(snapshotMulti.hasChanged(),true,id,seq+1);
+  snapshotMulti.getSnapshot(snapshot);
+  check(snapshot.value,700,id,seq+2);
+  check(snapshot.mappedValue,POTI_MAPPING_UNDEFINED,id,seq+3);
+  historyMulti.setRawValue(100);
+  check(historyMulti.hasChanged(),true,id,seq+4);
+  historyMulti.setRawValue(900);
+  check(historyMulti.hasChanged(),true,id,seq+5);
+  check(historyMulti.getHistoryNum(),2,id,seq+6);
+  check(historyMulti.getHistoryValue(0),900,id,seq+7);
+  check(historyMulti.getHistoryValue(1),100,id,seq+8);
+
+  // performance
+
+  Serial.println("\nPerformance MultiMappedPoti:");
+
+  multi.setMaxAnalogValue(1023);
+  multi.setMapping(0, 10, 0);
+  multi.setMapping(1, 100, 0);
+  multi.setCenteredMapping(2, 11, 0, 10, 0);
+
+  Serial.print("1024 * hasChanged() with 3 outputs, numAvg 0, prevWeight 0: ");
+  multi.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    multi.setRawValue(i);
+    multi.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * hasChanged() of 3 single objects, numAvg 0, prevWeight 0: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    mapped10.setRawValue(i);
+    mapped10.hasChanged();
+    mapped100.setRawValue(i);
+    mapped100.hasChanged();
+    centered.setRawValue(i);
+    centered.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
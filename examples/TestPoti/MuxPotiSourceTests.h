@@ -0,0 +1,103 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef MUXPOTISOURCETESTS_TESTPOTI
+#define MUXPOTISOURCETESTS_TESTPOTI
+
+#include "Common.h"
+
+void doMuxPotiSourceTest(int id){  // ID_MUXSOURCETEST = 8
+  const uint8_t addressPins[4] = {2, 3, 4, 5};
+  TestMuxPotiSource mux16(INPUT_PIN, addressPins, 4, 16, 0);
+  TestMuxPotiSource mux5(INPUT_PIN, addressPins, 3, 5, 0);
+  TestMuxPotiSource muxSettle(INPUT_PIN, addressPins, 4, 16, 2000);
+  SourcedPoti<Poti> poti(&mux16, 5, 0);
+  SourcedPoti<MappedPoti> mappedPoti(&mux16, 15, 0, 0, 0, 10, 0);
+  unsigned long startmicro = 0;
+  int seq = 0;
+
+  check(mux16.getNumChannels(),16,id,seq+1);
+  for(uint8_t i = 0 ; i < 16 ; i++){
+    mux16.setSimValue(i, 10 * i);
+  }
+  mux16.begin();
+  for(uint8_t i = 0 ; i < 16 ; i++){
+    check(mux16.getRawValue(i),10 * i,id,seq+2);
+  }
+
+  // one address pin change per channel
+  seq = 10;
+  for(uint8_t i = 0 ; i < 16 ; i++){
+    mux16.setSimValue(i, 500 + i);
+  }
+  mux16.resetNumPinWrites();
+  for(uint8_t i = 0 ; i < 16 ; i++){
+    check(mux16.update(),true,id,seq+1);
+    check(mux16.getNumPinWrites(),i + 1,id,seq+2);
+  }
+  for(uint8_t i = 0 ; i < 16 ; i++){
+    check(mux16.getRawValue(i),500 + i,id,seq+3);
+  }
+
+  // not all channels of the multiplexer used
+  seq = 20;
+  check(mux5.getNumChannels(),5,id,seq+1);
+  for(uint8_t i = 0 ; i < 8 ; i++){
+    mux5.setSimValue(i, 100 + i);
+  }
+  mux5.begin();
+  for(uint8_t i = 0 ; i < 5 ; i++){
+    check(mux5.getRawValue(i),100 + i,id,seq+2);
+  }
+  for(uint8_t i = 0 ; i < 5 ; i++){
+    mux5.setSimValue(i, 200 + i);
+  }
+  for(uint8_t i = 0 ; i < 5 ; i++){
+    check(mux5.update(),true,id,seq+3);
+  }
+  for(uint8_t i = 0 ; i < 5 ; i++){
+    check(mux5.getRawValue(i),200 + i,id,seq+4);
+  }
+
+  // no waiting for the settle time
+  seq = 30;
+  muxSettle.begin();
+  check(muxSettle.update(),false,id,seq+1);
+  delayMicroseconds(2500);
+  check(muxSettle.update(),true,id,seq+2);
+  check(muxSettle.update(),false,id,seq+3);
+
+  // Poti classes with values of the multiplexer
+  seq = 40;
+  check(poti.hasChanged(),true,id,seq+1);
+  check(poti.getValue(),505,id,seq+2);
+  check(mappedPoti.hasChanged(),true,id,seq+3);
+  check(mappedPoti.getValue(),515,id,seq+4);
+  check(mappedPoti.getMappedValue(),5,id,seq+5);
+  mux16.setSimValue(5, 0);
+  mux16.setSimValue(15, 1023);
+  for(uint8_t i = 0 ; i < 16 ; i++){
+    mux16.update();
+  }
+  check(poti.hasChanged(),true,id,seq+6);
+  check(poti.getValue(),0,id,seq+7);
+  check(poti.getPrevValue(),505,id,seq+8);
+  check(mappedPoti.hasChanged(),true,id,seq+9);
+  check(mappedPoti.getMappedValue(),9,id,seq+10);
+
+  // performance
+
+  Serial.println("\nPerformance MuxPotiSource:");
+
+  Serial.print("1024 * update(), 16 channels: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    mux16.update();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
@@ -0,0 +1,185 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef POTICOLLECTIONTESTS_TESTPOTI
+#define POTICOLLECTIONTESTS_TESTPOTI
+
+#include "Common.h"
+
+void doPotiCollectionTest(int id){  // ID_COLLECTIONTEST = 16
+  PotiCollection<8> collection;
+  PotiCollection<2> smallCollection;
+  TestPoti poti(INPUT_PIN, 0);
+  TestStablePoti stablePoti(INPUT_PIN, 0, 4, 0);
+  TestMappedPoti mappedPoti(INPUT_PIN, 0, 0, 0, 10, 5);
+  TestCenteredPoti centeredPoti(INPUT_PIN, 0, 0, 0, 11, 0, 20, 0);
+  TestHalfShiftMappedPoti halfShiftPoti(INPUT_PIN, 0, 0, 0, 10, 0);
+  TestTaperedPoti taperedPoti(INPUT_PIN, 0, 0, 0, 10, NULL, 0);
+  TestWideMappedPoti widePoti(INPUT_PIN, 0, 0, 0, 1024);
+  VelocityPoti<TestMappedPoti> velocityPoti(INPUT_PIN, 0, 0, 0, 10, 0);
+  TestMultiMappedPoti multiPoti(INPUT_PIN, 0, 0, 0);
+  // reference objects, called directly
+  TestPoti potiRef(INPUT_PIN, 0);
+  TestStablePoti stableRef(INPUT_PIN, 0, 4, 0);
+  TestMappedPoti mappedRef(INPUT_PIN, 0, 0, 0, 10, 5);
+  TestCenteredPoti centeredRef(INPUT_PIN, 0, 0, 0, 11, 0, 20, 0);
+  TestHalfShiftMappedPoti halfShiftRef(INPUT_PIN, 0, 0, 0, 10, 0);
+  TestTaperedPoti taperedRef(INPUT_PIN, 0, 0, 0, 10, NULL, 0);
+  TestWideMappedPoti wideRef(INPUT_PIN, 0, 0, 0, 1024);
+  VelocityPoti<TestMappedPoti> velocityRef(INPUT_PIN, 0, 0, 0, 10, 0);
+  bool changed[8];
+  bool anyChanged;
+  unsigned long startmicro = 0;
+  int seq = 0;
+  int value;
+
+  // type tags by the class, that declares hasChanged()
+  check(collection.getNumPotis(),0,id,seq+1);
+  check(collection.add(poti),0,id,seq+2);
+  check(collection.add(stablePoti),1,id,seq+2);
+  check(collection.add(mappedPoti),2,id,seq+2);
+  check(collection.add(centeredPoti),3,id,seq+2);
+  check(collection.add(halfShiftPoti),4,id,seq+2);
+  check(collection.add(taperedPoti),5,id,seq+2);
+  check(collection.add(widePoti),6,id,seq+2);
+  check(collection.add(velocityPoti),7,id,seq+2);
+  check(collection.add(poti),POTI_COLLECTION_FULL,id,seq+3);
+  check(collection.getNumPotis(),8,id,seq+4);
+  check(collection.getType(0),POTI_TYPE_POTI,id,seq+5);
+  check(collection.getType(1),POTI_TYPE_STABLE,id,seq+5);
+  check(collection.getType(2),POTI_TYPE_MAPPED,id,seq+5);
+  check(collection.getType(3),POTI_TYPE_CENTERED,id,seq+5);
+  check(collection.getType(4),POTI_TYPE_HALF_SHIFT,id,seq+5);
+  check(collection.getType(5),POTI_TYPE_TAPERED,id,seq+5);
+  check(collection.getType(6),POTI_TYPE_WIDE_MAPPED,id,seq+5);
+  check(collection.getType(7),POTI_TYPE_CUSTOM,id,seq+5);
+  check(collection.getPoti(2) == &mappedPoti,true,id,seq+6);
+  check(collection.getMappedValue(0),POTI_MAPPING_UNDEFINED,id,seq+7);
+  check(collection.getMappedValue(6),WIDE_POTI_MAPPING_UNDEFINED,id,seq+7);
+  check(smallCollection.add(mappedPoti),0,id,seq+8);
+  check(smallCollection.add(mappedPoti),1,id,seq+8);
+  check(smallCollection.add(mappedPoti),POTI_COLLECTION_FULL,id,seq+8);
+
+  // mapping changes only, not every analog change
+  seq = 10;
+  mappedPoti.setRawValue(150);
+  check(collection.hasChanged(),true,id,seq+1);
+  check(collection.hasChanged(2),true,id,seq+2);
+  check(collection.getMappedValue(2),mappedPoti.getMappedValue(),id,seq+3);
+  mappedPoti.setRawValue(155);
+  collection.hasChanged();
+  check(collection.hasChanged(2),false,id,seq+4);
+  check(collection.getValue(2),150,id,seq+5);
+  collection.reset();
+  check(collection.getValue(2),POTI_VALUE_UNDEFINED,id,seq+6);
+  check(collection.getMappedValue(2),POTI_MAPPING_UNDEFINED,id,seq+7);
+  check(collection.hasChanged(2),false,id,seq+8);
+
+  // shared value of MultiMappedPoti, without mapping values of the collection
+  seq = 15;
+  PotiCollection<1> multiCollection;
+  check(multiCollection.add(multiPoti),0,id,seq+1);
+  check(multiCollection.getType(0),POTI_TYPE_CUSTOM,id,seq+1);
+  multiPoti.setMapping(0, 10, 0);
+  multiPoti.setRawValue(600);
+  check(multiCollection.hasChanged(),true,id,seq+2);
+  check(multiCollection.getValue(0),600,id,seq+3);
+  check(multiCollection.getPoti(0)->getValue(),600,id,seq+3);
+  check(multiCollection.getMappedValue(0),POTI_MAPPING_UNDEFINED,id,seq+4);
+  check(multiPoti.getMappedValue(0),5,id,seq+5);
+
+  // identical results as direct calls of the objects
+  seq = 20;
+  for(int i = 0 ; i < 200 ; i++){
+    value = (i < 100 ? (i * 97 + (i & 0x03) * 5) % 1024 : 300 + (i * 7) % 200);
+    poti.setRawValue(value);
+    stablePoti.setRawValue(value);
+    mappedPoti.setRawValue(value);
+    centeredPoti.setRawValue(value);
+    halfShiftPoti.setRawValue(value);
+    taperedPoti.setRawValue(value);
+    widePoti.setRawValue(value);
+    velocityPoti.setRawValue(value);
+    potiRef.setRawValue(value);
+    stableRef.setRawValue(value);
+    mappedRef.setRawValue(value);
+    centeredRef.setRawValue(value);
+    halfShiftRef.setRawValue(value);
+    taperedRef.setRawValue(value);
+    wideRef.setRawValue(value);
+    velocityRef.setRawValue(value);
+
+    anyChanged = collection.hasChanged();
+    changed[0] = potiRef.hasChanged();
+    changed[1] = stableRef.hasChanged();
+    changed[2] = mappedRef.hasChanged();
+    changed[3] = centeredRef.hasChanged();
+    changed[4] = halfShiftRef.hasChanged();
+    changed[5] = taperedRef.hasChanged();
+    changed[6] = wideRef.hasChanged();
+    changed[7] = velocityRef.hasChanged();
+
+    for(uint8_t k = 0 ; k < 8 ; k++){
+      check(collection.hasChanged(k),changed[k],id,seq+1+k);
+    }
+    check(anyChanged,changed[0] || changed[1] || changed[2] || changed[3]
+      || changed[4] || changed[5] || changed[6] || changed[7],id,seq+9);
+    check(collection.getValue(1),stableRef.getValue(),id,seq+10);
+    check(collection.getMappedValue(2),mappedRef.getMappedValue(),id,seq+11);
+    check(collection.getMappedPrevValue(2),mappedRef.getMappedPrevValue(),id,seq+11);
+    check(collection.getMappedValue(3),centeredRef.getMappedValue(),id,seq+12);
+    check(collection.getMappedValue(4),halfShiftRef.getMappedValue(),id,seq+13);
+    check(collection.getMappedValue(5),taperedRef.getMappedValue(),id,seq+14);
+    check(collection.getMappedValue(6),wideRef.getMappedValue(),id,seq+15);
+    check(collection.getMappedValue(7),velocityRef.getMappedValue(),id,seq+16);
+    check(velocityPoti.getVelocity() == velocityRef.getVelocity(),true,id,seq+17);
+  }
+
+  // performance
+
+  Serial.println("\nPerformance PotiCollection:");
+
+  Serial.print("1024 * hasChanged() of a collection with 8 objects: ");
+  collection.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    poti.setRawValue(i);
+    stablePoti.setRawValue(i);
+    mappedPoti.setRawValue(i);
+    centeredPoti.setRawValue(i);
+    halfShiftPoti.setRawValue(i);
+    taperedPoti.setRawValue(i);
+    widePoti.setRawValue(i);
+    velocityPoti.setRawValue(i);
+    collection.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * hasChanged() of 8 single objects: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    potiRef.setRawValue(i);
+    stableRef.setRawValue(i);
+    mappedRef.setRawValue(i);
+    centeredRef.setRawValue(i);
+    halfShiftRef.setRawValue(i);
+    taperedRef.setRawValue(i);
+    wideRef.setRawValue(i);
+    velocityRef.setRawValue(i);
+    potiRef.hasChanged();
+    stableRef.hasChanged();
+    mappedRef.hasChanged();
+    centeredRef.hasChanged();
+    halfShiftRef.hasChanged();
+    taperedRef.hasChanged();
+    wideRef.hasChanged();
+    velocityRef.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
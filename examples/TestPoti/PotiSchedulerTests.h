@@ -0,0 +1,251 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef POTISCHEDULERTESTS_TESTPOTI
+#define POTISCHEDULERTESTS_TESTPOTI
+
+#include "Common.h"
+
+// sum of the measurements of the staggered objects
+unsigned int getStaggeredReads(TestCountingPoti potis[]){
+  unsigned int reads = 0;
+
+  for(uint8_t i = 0 ; i < 8 ; i++){
+    reads += potis[i].getNumReads();
+  }
+  return reads;
+}
+
+// measurements in each millisecond of one read cycle of 10 milliseconds
+void pollStaggeredCycle(PotiScheduler<8>& scheduler, TestCountingPoti potis[], uint8_t reads[]){
+  unsigned int prevReads;
+
+  for(uint8_t t = 0 ; t < 10 ; t++){
+    addVirtualMillis(1);
+    prevReads = getStaggeredReads(potis);
+    scheduler.poll();
+    reads[t] = getStaggeredReads(potis) - prevReads;
+  }
+}
+
+void doPotiSchedulerTest(int id){  // ID_SCHEDULERTEST = 19
+  PotiScheduler<4> scheduler;
+  TestCountingPoti poti10(INPUT_PIN, 10, 0, 0);
+  TestCountingPoti potiAvg(INPUT_PIN, 20, 0, 2);
+  TestCountingPoti poti0(INPUT_PIN, 0, 0, 0);
+  TestMappedPoti mappedPoti(INPUT_PIN, 5, 0, 0, 10, 0);
+  PotiScheduler<8> staggered;
+  TestCountingPoti potis[8] = {
+    TestCountingPoti(INPUT_PIN, 10, 0, 0), TestCountingPoti(INPUT_PIN, 10, 0, 0),
+    TestCountingPoti(INPUT_PIN, 10, 0, 0), TestCountingPoti(INPUT_PIN, 10, 0, 0),
+    TestCountingPoti(INPUT_PIN, 10, 0, 0), TestCountingPoti(INPUT_PIN, 10, 0, 0),
+    TestCountingPoti(INPUT_PIN, 10, 0, 0), TestCountingPoti(INPUT_PIN, 10, 0, 0)
+  };
+  uint8_t cycleReads[10], stallReads[10];
+  unsigned long startmicro = 0;
+  unsigned int reads;
+  bool found;
+  int seq = 0;
+
+  // time of the next measurement
+  setVirtualMillis(1000);
+  check(poti10.getNextReadMillis() == 1000,true,id,seq+1);
+  poti10.setRawValue(100);
+  check(poti10.hasChanged(),true,id,seq+2);
+  check(poti10.getNextReadMillis() == 1010,true,id,seq+3);
+  potiAvg.setRawValue(200);
+  check(potiAvg.hasChanged(),true,id,seq+4);
+  addVirtualMillis(21);
+  check(potiAvg.getNextReadMillis() == 1020,true,id,seq+5);
+  check(potiAvg.hasChanged(),false,id,seq+6);
+  // additional measurements of the average with 1 ms difference
+  check(potiAvg.getNextReadMillis() == 1022,true,id,seq+7);
+  // measurement accounted at its scheduled time, if less than one cycle later
+  poti10.alignReadMillis(1015);
+  check(poti10.getNextReadMillis() == 1010,true,id,seq+8);
+  check(poti10.hasChanged(),false,id,seq+9);
+  poti10.alignReadMillis(1015);
+  check(poti10.getNextReadMillis() == 1025,true,id,seq+10);
+  poti10.reset();
+  potiAvg.reset();
+
+  // adding objects, staggered starts within the read cycles by first poll
+  seq = 10;
+  setVirtualMillis(2000);
+  poti0.setRawValue(300);
+  mappedPoti.setRawValue(400);
+  check(scheduler.add(poti10),0,id,seq+1);
+  check(scheduler.add(potiAvg),1,id,seq+2);
+  check(scheduler.add(poti0),2,id,seq+3);
+  check(scheduler.add(mappedPoti),3,id,seq+4);
+  check(scheduler.add(poti0),POTI_SCHEDULER_FULL,id,seq+5);
+  check(scheduler.getNumPotis(),4,id,seq+6);
+  check(scheduler.poll(),2,id,seq+7);
+  check(scheduler.hasChanged(0) && scheduler.hasChanged(2),true,id,seq+8);
+  check(scheduler.hasChanged(1),false,id,seq+9);
+  for(uint8_t t = 0 ; t < 10 ; t++){
+    addVirtualMillis(1);
+    scheduler.poll();
+  }
+  check(potiAvg.getValue(),200,id,seq+10);
+  check(scheduler.getPoti(3)->getValue(),400,id,seq+11);
+  check(scheduler.poll(),0,id,seq+12);
+  check(scheduler.hasChanged(0),false,id,seq+13);
+
+  // measurements only when due
+  seq = 20;
+  poti10.clearNumReads();
+  potiAvg.clearNumReads();
+  poti0.clearNumReads();
+  for(uint8_t t = 0 ; t < 100 ; t++){
+    addVirtualMillis(1);
+    scheduler.poll();
+  }
+  check(poti10.getNumReads(),10,id,seq+1);
+  check(potiAvg.getNumReads(),12,id,seq+2);
+  check(poti0.getNumReads(),100,id,seq+3);
+  check(mappedPoti.getValue(),400,id,seq+4);
+
+  // changes are reported with the next measurement
+  seq = 30;
+  poti10.setRawValue(500);
+  found = false;
+  for(uint8_t t = 0 ; t < 10 && !found ; t++){
+    addVirtualMillis(1);
+    if(scheduler.poll() > 0){
+      for(uint16_t k = 0 ; k < scheduler.getNumChanged() ; k++){
+        found = found || (scheduler.getChanged(k) == 0);
+      }
+    }
+  }
+  check(found,true,id,seq+1);
+  check(scheduler.hasChanged(0),true,id,seq+2);
+  check(scheduler.getPoti(0)->getValue(),500,id,seq+3);
+
+  // objects are due immediately after reset and reschedule
+  seq = 40;
+  poti10.reset();
+  scheduler.reschedule();
+  check(scheduler.poll() >= 1,true,id,seq+1);
+  check(scheduler.hasChanged(0),true,id,seq+2);
+
+  // staggered measurements of objects with the same read cycle
+  seq = 50;
+  setVirtualMillis(3000);
+  for(uint8_t i = 0 ; i < 8 ; i++){
+    potis[i].setRawValue(100 + i);
+    check(staggered.add(potis[i]),i,id,seq+1);
+  }
+  check(staggered.getMaxReadsPerPoll(),0,id,seq+2);
+  staggered.poll();
+  check(getStaggeredReads(potis),1,id,seq+3);
+  check(potis[0].getNumReads(),1,id,seq+4);
+  pollStaggeredCycle(staggered, potis, cycleReads);
+  check(potis[7].getValue(),107,id,seq+5);
+  check(getStaggeredReads(potis),9,id,seq+6);
+  // at most one measurement per millisecond
+  found = true;
+  for(uint8_t t = 0 ; t < 10 ; t++){
+    found = found && cycleReads[t] <= 1;
+  }
+  check(found,true,id,seq+7);
+
+  // a stall shorter than the read cycle keeps the phase of all objects
+  seq = 60;
+  pollStaggeredCycle(staggered, potis, stallReads);
+  check(memcmp(cycleReads, stallReads, 10),0,id,seq+1);
+  potis[0].clearNumReads();
+  reads = getStaggeredReads(potis);
+  addVirtualMillis(6);
+  staggered.poll();
+  check(getStaggeredReads(potis) - reads,5,id,seq+2);
+  // rest of the stalled cycle
+  for(uint8_t t = 0 ; t < 4 ; t++){
+    addVirtualMillis(1);
+    staggered.poll();
+  }
+  pollStaggeredCycle(staggered, potis, stallReads);
+  check(memcmp(cycleReads, stallReads, 10),0,id,seq+3);
+  pollStaggeredCycle(staggered, potis, stallReads);
+  check(memcmp(cycleReads, stallReads, 10),0,id,seq+4);
+  check(potis[0].getNumReads(),3,id,seq+5);
+
+  // a stall of a full read cycle starts a new common phase
+  seq = 70;
+  reads = getStaggeredReads(potis);
+  addVirtualMillis(25);
+  staggered.poll();
+  check(getStaggeredReads(potis) - reads,8,id,seq+1);
+  for(uint8_t t = 0 ; t < 9 ; t++){
+    addVirtualMillis(1);
+    staggered.poll();
+  }
+  check(getStaggeredReads(potis) - reads,8,id,seq+2);
+  addVirtualMillis(1);
+  staggered.poll();
+  check(getStaggeredReads(potis) - reads,16,id,seq+3);
+  // spread again by reset and reschedule
+  for(uint8_t i = 0 ; i < 8 ; i++){
+    potis[i].reset();
+  }
+  staggered.reschedule();
+  staggered.poll();
+  pollStaggeredCycle(staggered, potis, stallReads);
+  found = true;
+  for(uint8_t t = 0 ; t < 10 ; t++){
+    found = found && stallReads[t] <= 1;
+  }
+  check(found,true,id,seq+4);
+
+  // limited number of measurements per poll, all due objects are called
+  // within the same millisecond and keep their phase
+  seq = 80;
+  pollStaggeredCycle(staggered, potis, cycleReads);
+  staggered.setMaxReadsPerPoll(3);
+  check(staggered.getMaxReadsPerPoll(),3,id,seq+1);
+  for(uint8_t i = 0 ; i < 8 ; i++){
+    potis[i].clearNumReads();
+  }
+  addVirtualMillis(9);
+  staggered.poll();
+  check(getStaggeredReads(potis),3,id,seq+2);
+  staggered.poll();
+  check(getStaggeredReads(potis),6,id,seq+3);
+  staggered.poll();
+  check(getStaggeredReads(potis),7,id,seq+4);
+  staggered.poll();
+  check(getStaggeredReads(potis),7,id,seq+5);
+  addVirtualMillis(1);
+  staggered.poll();
+  pollStaggeredCycle(staggered, potis, stallReads);
+  check(memcmp(cycleReads, stallReads, 10),0,id,seq+6);
+  staggered.setMaxReadsPerPoll(0);
+  useRealMillis();
+
+  // performance
+
+  Serial.println("\nPerformance Scheduler:");
+
+  Serial.print("1024 * poll() with 4 objects: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    scheduler.poll();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * hasChanged() of 4 objects: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    poti10.hasChanged();
+    potiAvg.hasChanged();
+    poti0.hasChanged();
+    mappedPoti.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
@@ -0,0 +1,112 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef SETTLEDPOTITESTS_TESTPOTI
+#define SETTLEDPOTITESTS_TESTPOTI
+
+#include "Common.h"
+
+void doSettledPotiTest(int id){  // ID_SETTLEDTEST = 18
+  SettledPoti<TestMappedPoti> mappedPoti(INPUT_PIN, 0, 0, 0, 10, 0);
+  SettledPoti<TestPoti> poti(INPUT_PIN, 0);
+  unsigned long startmicro = 0;
+  int seq = 0;
+
+  check(mappedPoti.getSettleMillis(),SETTLED_POTI_DEFAULT_MILLIS,id,seq+1);
+  mappedPoti.setSettleMillis(20);
+  check(mappedPoti.getSettleMillis(),20,id,seq+2);
+  check(mappedPoti.getSettledValue(),POTI_VALUE_UNDEFINED,id,seq+3);
+  check(mappedPoti.getSettledMappedValue(),POTI_MAPPING_UNDEFINED,id,seq+4);
+  check(mappedPoti.hasSettled(),false,id,seq+5);
+  setVirtualMillis(1000);
+  mappedPoti.setRawValue(150);
+  check(mappedPoti.hasChanged(),true,id,seq+6);
+  check(mappedPoti.isSettling(),true,id,seq+7);
+  check(mappedPoti.hasSettled(),false,id,seq+8);
+  // settled exactly settleMillis after the change
+  addVirtualMillis(19);
+  check(mappedPoti.hasChanged(),false,id,seq+9);
+  check(mappedPoti.hasSettled(),false,id,seq+10);
+  addVirtualMillis(1);
+  check(mappedPoti.hasSettled(),true,id,seq+11);
+  check(mappedPoti.getSettledValue(),150,id,seq+12);
+  check(mappedPoti.getSettledMappedValue(),1,id,seq+13);
+  check(mappedPoti.hasSettled(),false,id,seq+14);
+  check(mappedPoti.isSettling(),false,id,seq+15);
+
+  // preview values while turning, settled after the last change
+  seq = 20;
+  mappedPoti.setRawValue(350);
+  check(mappedPoti.hasChanged(),true,id,seq+1);
+  addVirtualMillis(10);
+  mappedPoti.setRawValue(550);
+  check(mappedPoti.hasChanged(),true,id,seq+2);
+  check(mappedPoti.getMappedValue(),5,id,seq+3);
+  // time since the first change of the turn is not relevant
+  addVirtualMillis(19);
+  check(mappedPoti.hasSettled(),false,id,seq+4);
+  check(mappedPoti.getSettledMappedValue(),1,id,seq+5);
+  addVirtualMillis(1);
+  check(mappedPoti.hasSettled(),true,id,seq+6);
+  check(mappedPoti.getSettledValue(),550,id,seq+7);
+  check(mappedPoti.getSettledMappedValue(),5,id,seq+8);
+
+  // turn back to the settled mapping value is not reported
+  seq = 30;
+  mappedPoti.setRawValue(900);
+  check(mappedPoti.hasChanged(),true,id,seq+1);
+  mappedPoti.setRawValue(560);
+  check(mappedPoti.hasChanged(),true,id,seq+2);
+  addVirtualMillis(20);
+  check(mappedPoti.hasSettled(),false,id,seq+3);
+  check(mappedPoti.isSettling(),false,id,seq+4);
+  check(mappedPoti.getSettledValue(),550,id,seq+5);
+  mappedPoti.reset();
+  check(mappedPoti.getSettledValue(),POTI_VALUE_UNDEFINED,id,seq+6);
+  check(mappedPoti.getSettleMillis(),20,id,seq+7);
+
+  // class without mapping
+  seq = 40;
+  poti.setSettleMillis(20);
+  poti.setRawValue(10);
+  check(poti.hasChanged(),true,id,seq+1);
+  addVirtualMillis(19);
+  check(poti.hasSettled(),false,id,seq+2);
+  addVirtualMillis(1);
+  check(poti.hasSettled(),true,id,seq+3);
+  check(poti.getSettledValue(),10,id,seq+4);
+  check(poti.getSettledMappedValue(),POTI_MAPPING_UNDEFINED,id,seq+5);
+  poti.setRawValue(20);
+  check(poti.hasChanged(),true,id,seq+6);
+  poti.setRawValue(10);
+  check(poti.hasChanged(),true,id,seq+7);
+  addVirtualMillis(20);
+  check(poti.hasSettled(),false,id,seq+8);
+  poti.setRawValue(30);
+  check(poti.hasChanged(),true,id,seq+9);
+  addVirtualMillis(19);
+  check(poti.hasSettled(),false,id,seq+10);
+  addVirtualMillis(1);
+  check(poti.hasSettled(),true,id,seq+11);
+  check(poti.getSettledValue(),30,id,seq+12);
+  useRealMillis();
+
+  // performance
+
+  Serial.println("\nPerformance Settled:");
+
+  Serial.print("1024 * hasChanged() and hasSettled(): ");
+  mappedPoti.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    mappedPoti.setRawValue(i);
+    mappedPoti.hasChanged();
+    mappedPoti.hasSettled();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
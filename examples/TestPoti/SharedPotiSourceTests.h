@@ -0,0 +1,83 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef SHAREDPOTISOURCETESTS_TESTPOTI
+#define SHAREDPOTISOURCETESTS_TESTPOTI
+
+#include "Common.h"
+
+// waits for the begin of the next tick of millis()
+void waitForNextTick(){
+  unsigned long current = millis();
+  while(millis() == current){
+  }
+}
+
+void doSharedPotiSourceTest(int id){  // ID_SHAREDSOURCETEST = 10
+  TestSharedPotiSource source;
+  SourcedPoti<Poti> poti(&source, 0, 0);
+  SourcedPoti<MappedPoti> poti10(&source, 0, 0, 0, 0, 10, 0);
+  SourcedPoti<MappedPoti> poti100(&source, 0, 0, 0, 0, 100, 0);
+  SourcedPoti<MappedPoti> potiPin1(&source, 1, 0, 0, 0, 100, 0);
+  unsigned long startmicro = 0;
+  int seq = 0;
+
+  // one conversion per pin and tick
+  source.setSimValue(500);
+  waitForNextTick();
+  check(poti.hasChanged(),true,id,seq+1);
+  check(poti10.hasChanged(),true,id,seq+2);
+  check(poti100.hasChanged(),true,id,seq+3);
+  check(potiPin1.hasChanged(),true,id,seq+4);
+  check(source.getNumReads(),2,id,seq+5);
+  check(poti.getValue(),500,id,seq+6);
+  check(poti10.getMappedValue(),4,id,seq+7);
+  check(poti100.getMappedValue(),48,id,seq+8);
+  check(potiPin1.getValue(),501,id,seq+9);
+
+  // new conversion with next tick
+  seq = 10;
+  source.setSimValue(1000);
+  source.resetNumReads();
+  waitForNextTick();
+  check(poti.hasChanged(),true,id,seq+1);
+  check(poti10.hasChanged(),true,id,seq+2);
+  check(poti100.hasChanged(),true,id,seq+3);
+  check(source.getNumReads(),1,id,seq+4);
+  check(poti.getValue(),1000,id,seq+5);
+  check(poti10.getMappedValue(),9,id,seq+6);
+  check(poti100.getMappedValue(),97,id,seq+7);
+
+  // cached value within the same tick
+  seq = 20;
+  source.setSimValue(0);
+  check(source.getRawValue(0),1000,id,seq+1);
+  source.reset();
+  check(source.getRawValue(0),0,id,seq+2);
+
+  // more pins than cache entries are read directly
+  seq = 30;
+  source.reset();
+  source.resetNumReads();
+  for(uint8_t i = 0 ; i < SHARED_POTI_SOURCE_MAX_PINS + 2 ; i++){
+    check(source.getRawValue(i),i,id,seq+1);
+  }
+  check(source.getRawValue(SHARED_POTI_SOURCE_MAX_PINS + 1),SHARED_POTI_SOURCE_MAX_PINS + 1,id,seq+2);
+  check(source.getNumReads(),SHARED_POTI_SOURCE_MAX_PINS + 3,id,seq+3);
+
+  // performance
+
+  Serial.println("\nPerformance SharedPotiSource:");
+
+  Serial.print("1024 * getRawValue() cached: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    source.getRawValue(0);
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
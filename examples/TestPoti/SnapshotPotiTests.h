@@ -0,0 +1,115 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef SNAPSHOTPOTITESTS_TESTPOTI
+#define SNAPSHOTPOTITESTS_TESTPOTI
+
+#include "Common.h"
+
+void doSnapshotPotiTest(int id){  // ID_SNAPSHOTTEST = 15
+  SnapshotPoti<TestPoti> poti(INPUT_PIN, 0);
+  SnapshotPoti<TestMappedPoti> mappedPoti(INPUT_PIN, 0, 0, 0, 10, 0);
+  SnapshotPoti<TestCenteredPoti> centeredPoti(INPUT_PIN, 0, 0, 0, 11, 0, 10, 0);
+  SnapshotPoti<TestWideMappedPoti> widePoti(INPUT_PIN, 0, 0, 0, 1024);
+  TestMappedPoti mappedRef(INPUT_PIN, 0, 0, 0, 10, 0);
+  PotiSnapshot snapshot;
+  unsigned long startmicro = 0;
+  uint8_t seq0;
+  int seq = 0;
+
+  // undefined values before first change
+  seq0 = mappedPoti.getSnapshot(snapshot);
+  check(seq0,mappedPoti.getSnapshotSeq(),id,seq+1);
+  check(snapshot.value,POTI_VALUE_UNDEFINED,id,seq+2);
+  check(snapshot.prevValue,POTI_VALUE_UNDEFINED,id,seq+3);
+  check(snapshot.mappedValue,POTI_MAPPING_UNDEFINED,id,seq+4);
+  check(snapshot.prevMappedValue,POTI_MAPPING_UNDEFINED,id,seq+5);
+
+  // published with each change
+  seq = 10;
+  mappedPoti.setRawValue(150);
+  check(mappedPoti.hasChanged(),true,id,seq+1);
+  check(mappedPoti.getSnapshot(snapshot),(uint8_t)(seq0 + 1),id,seq+2);
+  check(snapshot.value,150,id,seq+3);
+  check(snapshot.mappedValue,1,id,seq+4);
+  check(snapshot.prevMappedValue,POTI_MAPPING_UNDEFINED,id,seq+5);
+  mappedPoti.setRawValue(160);
+  check(mappedPoti.hasChanged(),false,id,seq+6);
+  check(mappedPoti.getSnapshotSeq(),(uint8_t)(seq0 + 1),id,seq+7);
+  mappedPoti.setRawValue(900);
+  check(mappedPoti.hasChanged(),true,id,seq+8);
+  check(mappedPoti.getSnapshot(snapshot),(uint8_t)(seq0 + 2),id,seq+9);
+  check(snapshot.value,900,id,seq+10);
+  check(snapshot.prevValue,150,id,seq+11);
+  check(snapshot.mappedValue,8,id,seq+12);
+  check(snapshot.prevMappedValue,1,id,seq+13);
+  mappedPoti.reset();
+  mappedPoti.getSnapshot(snapshot);
+  check(snapshot.value,POTI_VALUE_UNDEFINED,id,seq+14);
+  check(snapshot.mappedValue,POTI_MAPPING_UNDEFINED,id,seq+15);
+
+  // classes without and with wide mapping
+  seq = 30;
+  poti.setRawValue(321);
+  check(poti.hasChanged(),true,id,seq+1);
+  poti.getSnapshot(snapshot);
+  check(snapshot.value,321,id,seq+2);
+  check(snapshot.mappedValue,POTI_MAPPING_UNDEFINED,id,seq+3);
+  centeredPoti.setRawValue(1023);
+  check(centeredPoti.hasChanged(),true,id,seq+4);
+  centeredPoti.getSnapshot(snapshot);
+  check(snapshot.mappedValue,centeredPoti.getMappedValue(),id,seq+5);
+  widePoti.getSnapshot(snapshot);
+  check(snapshot.mappedValue,WIDE_POTI_MAPPING_UNDEFINED,id,seq+6);
+  widePoti.setRawValue(1000);
+  check(widePoti.hasChanged(),true,id,seq+7);
+  widePoti.getSnapshot(snapshot);
+  check(snapshot.mappedValue,1000,id,seq+8);
+
+  // identical values as the Poti object
+  seq = 40;
+  for(int i = 0 ; i < 200 ; i++){
+    mappedPoti.setRawValue((i * 97) % 1024);
+    mappedPoti.hasChanged();
+    mappedPoti.getSnapshot(snapshot);
+    check(snapshot.value,mappedPoti.getValue(),id,seq+1);
+    check(snapshot.prevValue,mappedPoti.getPrevValue(),id,seq+2);
+    check(snapshot.mappedValue,mappedPoti.getMappedValue(),id,seq+3);
+    check(snapshot.prevMappedValue,mappedPoti.getMappedPrevValue(),id,seq+4);
+  }
+
+  // performance
+
+  Serial.println("\nPerformance Snapshot:");
+
+  Serial.print("1024 * hasChanged() with snapshots: ");
+  mappedPoti.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    mappedPoti.setRawValue(i);
+    mappedPoti.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * hasChanged() without snapshots: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    mappedRef.setRawValue(i);
+    mappedRef.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * getSnapshot(): ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    mappedPoti.getSnapshot(snapshot);
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
@@ -0,0 +1,72 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef SPIADCPOTISOURCETESTS_TESTPOTI
+#define SPIADCPOTISOURCETESTS_TESTPOTI
+
+#include "Common.h"
+
+void doSpiAdcPotiSourceTest(int id){  // ID_SPIADCSOURCETEST = 9
+  TestSpiAdcPotiSource adc10(10, SPI_ADC_MCP3008, 8, 0);
+  TestSpiAdcPotiSource adc12(10, SPI_ADC_MCP3208, 8, 0);
+  TestSpiAdcPotiSource adcWait(10, SPI_ADC_MCP3208, 4, 2);
+  SourcedPoti<MappedPoti> mappedPoti(&adc12, 7, 0, 0, 0, 16, 0);
+  unsigned long startmicro = 0;
+  int seq = 0;
+
+  check(adc10.getMaxAnalogValue(),1023,id,seq+1);
+  check(adc12.getMaxAnalogValue(),4095,id,seq+2);
+  for(uint8_t i = 0 ; i < 8 ; i++){
+    adc10.setSimValue(i, 1023 - 100 * i);
+    adc12.setSimValue(i, 4095 - 500 * i);
+  }
+  adc10.begin();
+  adc12.begin();
+  for(uint8_t i = 0 ; i < 8 ; i++){
+    check(adc10.getRawValue(i),1023 - 100 * i,id,seq+3);
+    check(adc12.getRawValue(i),4095 - 500 * i,id,seq+4);
+  }
+
+  // one burst for all channels
+  seq = 10;
+  adc12.setSimValue(3, 1234);
+  check(adc12.update(),true,id,seq+1);
+  check(adc12.getNumSelects(),16,id,seq+2);
+  check(adc12.getRawValue(3),1234,id,seq+3);
+
+  // reduction of the scans by readCycleMillis
+  seq = 20;
+  check(adcWait.getNumChannels(),4,id,seq+1);
+  adcWait.begin();
+  check(adcWait.update(),false,id,seq+2);
+  delay(2);
+  check(adcWait.update(),true,id,seq+3);
+  check(adcWait.getNumSelects(),8,id,seq+4);
+
+  // 12 bit values with mapping
+  seq = 30;
+  check(mappedPoti.setMaxAnalogValue(adc12.getMaxAnalogValue()),4095,id,seq+1);
+  check(mappedPoti.hasChanged(),true,id,seq+2);
+  check(mappedPoti.getValue(),595,id,seq+3);
+  check(mappedPoti.getMappedValue(),2,id,seq+4);
+  adc12.setSimValue(7, 4095);
+  adc12.update();
+  check(mappedPoti.hasChanged(),true,id,seq+5);
+  check(mappedPoti.getMappedValue(),15,id,seq+6);
+
+  // performance
+
+  Serial.println("\nPerformance SpiAdcPotiSource:");
+
+  Serial.print("1024 * update(), 8 channels: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    adc12.update();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
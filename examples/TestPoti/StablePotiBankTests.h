@@ -0,0 +1,140 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef STABLEPOTIBANKTESTS_TESTPOTI
+#define STABLEPOTIBANKTESTS_TESTPOTI
+
+#include "Common.h"
+
+// compare all channels of the bank with single StablePoti objects
+void checkStablePotiBank(uint8_t weightPrev, uint8_t addNumRawAvg, int id, int seq){
+  const uint8_t pins[4] = {INPUT_PIN, INPUT_PIN, INPUT_PIN, INPUT_PIN};
+  TestStablePotiBank bank(pins, 0, weightPrev, addNumRawAvg);
+  TestStablePoti poti0(INPUT_PIN, 0, weightPrev, addNumRawAvg);
+  TestStablePoti poti1(INPUT_PIN, 0, weightPrev, addNumRawAvg);
+  TestStablePoti poti2(INPUT_PIN, 0, weightPrev, addNumRawAvg);
+  TestStablePoti poti3(INPUT_PIN, 0, weightPrev, addNumRawAvg);
+  TestStablePoti* potis[4] = {&poti0, &poti1, &poti2, &poti3};
+  bool changed, potiChanged, anyChanged;
+  int value;
+
+  check(bank.getNumChannels(),4,id,seq+1);
+  for(int i = 0 ; i < 60 ; i++){
+    // ensures that every object measures in this step
+    delay(1);
+    for(uint8_t k = 0 ; k < 4 ; k++){
+      value = (i * 37 * (k + 1) + k * 211) % 1024;
+      bank.setRawValue(k, value);
+      potis[k]->setRawValue(value);
+    }
+    changed = bank.hasChanged();
+    anyChanged = false;
+    for(uint8_t k = 0 ; k < 4 ; k++){
+      potiChanged = potis[k]->hasChanged();
+      anyChanged = anyChanged || potiChanged;
+      check(bank.hasChanged(k),potiChanged,id,seq+2);
+      check(bank.getValue(k),potis[k]->getValue(),id,seq+3);
+      check(bank.getPrevValue(k),potis[k]->getPrevValue(),id,seq+4);
+    }
+    check(changed,anyChanged,id,seq+5);
+  }
+
+  bank.reset();
+  for(uint8_t k = 0 ; k < 4 ; k++){
+    check(bank.getValue(k),POTI_VALUE_UNDEFINED,id,seq+6);
+    check(bank.getPrevValue(k),POTI_VALUE_UNDEFINED,id,seq+7);
+  }
+}
+
+void doStablePotiBankTest(int id){  // ID_STABLEBANKTEST = 6
+  const uint8_t pins[4] = {INPUT_PIN, INPUT_PIN, INPUT_PIN, INPUT_PIN};
+  TestStablePotiBank bank0Wait(pins, 0, 0, 0);
+  TestStablePotiBank bank10Wait(pins, 10, 0, 1);
+  TestStablePoti poti0Wait(INPUT_PIN, 0, 0, 0);
+  unsigned long startmicro = 0;
+  int seq = 0;
+
+  for(uint8_t k = 0 ; k < 4 ; k++){
+    check(bank0Wait.getValue(k),POTI_VALUE_UNDEFINED,id,seq+1);
+    check(bank0Wait.getPrevValue(k),POTI_VALUE_UNDEFINED,id,seq+2);
+    bank0Wait.setRawValue(k, 10 * k);
+  }
+  check(bank0Wait.hasChanged(),true,id,seq+3);
+  for(uint8_t k = 0 ; k < 4 ; k++){
+    check(bank0Wait.hasChanged(k),true,id,seq+4);
+    check(bank0Wait.getValue(k),10 * k,id,seq+5);
+  }
+  check(bank0Wait.hasChanged(),false,id,seq+6);
+  bank0Wait.setRawValue(2, 100);
+  check(bank0Wait.hasChanged(),true,id,seq+7);
+  check(bank0Wait.hasChanged(1),false,id,seq+8);
+  check(bank0Wait.hasChanged(2),true,id,seq+9);
+  check(bank0Wait.getValue(2),100,id,seq+10);
+  check(bank0Wait.getPrevValue(2),20,id,seq+11);
+
+  // identical values as StablePoti for all stabilization methods
+  checkStablePotiBank(0, 0, id, 20);
+  checkStablePotiBank(4, 0, id, 30);
+  checkStablePotiBank(0, 2, id, 40);
+  checkStablePotiBank(12, 7, id, 50);
+  checkStablePotiBank(1, 1, id, 60);
+
+  // no changes of channels reported by calls without completed measurement
+  seq = 70;
+  setVirtualMillis(1000);
+  for(uint8_t k = 0 ; k < 4 ; k++){
+    bank10Wait.setRawValue(k, 10 * k);
+  }
+  check(bank10Wait.hasChanged(),true,id,seq+1);
+  check(bank10Wait.hasChanged(3),true,id,seq+2);
+  // within the read cycle
+  addVirtualMillis(9);
+  bank10Wait.setRawValue(3, 500);
+  check(bank10Wait.hasChanged(),false,id,seq+3);
+  check(bank10Wait.hasChanged(0) || bank10Wait.hasChanged(3),false,id,seq+4);
+  // first measurement of the average
+  addVirtualMillis(1);
+  check(bank10Wait.hasChanged(),false,id,seq+5);
+  check(bank10Wait.hasChanged(3),false,id,seq+6);
+  // last measurement of the average
+  addVirtualMillis(1);
+  check(bank10Wait.hasChanged(),true,id,seq+7);
+  check(bank10Wait.hasChanged(3),true,id,seq+8);
+  check(bank10Wait.getValue(3),500,id,seq+9);
+  // within 1 ms of the next average
+  check(bank10Wait.hasChanged(),false,id,seq+10);
+  check(bank10Wait.hasChanged(3),false,id,seq+11);
+  useRealMillis();
+
+  // performance
+
+  Serial.println("\nPerformance StablePotiBank:");
+
+  Serial.print("1024 * 4 channels hasChanged(), numAvg 0, prevWeight 0: ");
+  bank0Wait.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    for(uint8_t k = 0 ; k < 4 ; k++){
+      bank0Wait.setRawValue(k, i);
+    }
+    bank0Wait.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * 4 StablePoti hasChanged(), numAvg 0, prevWeight 0: ");
+  poti0Wait.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    for(uint8_t k = 0 ; k < 4 ; k++){
+      poti0Wait.setRawValue(i);
+      poti0Wait.hasChanged();
+    }
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
@@ -0,0 +1,155 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef TAPEREDPOTITESTS_TESTPOTI
+#define TAPEREDPOTITESTS_TESTPOTI
+
+#include "Common.h"
+
+const uint16_t TEST_TAPER_LOG[] PROGMEM = {0, 0, 102, 512, 1023, 1023};
+const uint16_t TEST_TAPER_WORN[] PROGMEM = {20, 0, 100, 50, 300, 300, 500, 511, 800, 900, 1000, 1023};
+
+// reference calculation of the tapering with a full search
+int getReferenceTapering(const uint16_t* taper, uint8_t numPoints, int rawValue){
+  long rawLow, rawHigh, outLow, outHigh;
+
+  if(rawValue <= (int)pgm_read_word(&taper[0])){
+    return pgm_read_word(&taper[1]);
+  }
+  for(uint8_t i = 1 ; i < numPoints ; i++){
+    if(rawValue < (int)pgm_read_word(&taper[i * 2])){
+      rawLow = pgm_read_word(&taper[(i - 1) * 2]);
+      outLow = pgm_read_word(&taper[(i - 1) * 2 + 1]);
+      rawHigh = pgm_read_word(&taper[i * 2]);
+      outHigh = pgm_read_word(&taper[i * 2 + 1]);
+      return outLow + (rawValue - rawLow) * (outHigh - outLow) / (rawHigh - rawLow);
+    }
+  }
+  return pgm_read_word(&taper[(numPoints - 1) * 2 + 1]);
+}
+
+void doTaperedPotiTest(int id){  // ID_TAPEREDTEST = 7
+  TestTaperedPoti poti0Wait(INPUT_PIN, 0, 0, 0, 4, TEST_TAPER_LOG, 3);
+  TestMappedPoti mappedPoti(INPUT_PIN, 0, 0, 0, 4, 0);
+  unsigned long startmicro = 0;
+  int rawValues[64];
+  uint8_t mapValues[64];
+  int seq, i, low, high;
+
+  seq = 0;
+  check(poti0Wait.getValue(),POTI_VALUE_UNDEFINED,id,seq+1);
+  check(poti0Wait.getTaperedValue(),POTI_VALUE_UNDEFINED,id,seq+2);
+  poti0Wait.setRawValue(0);
+  check(poti0Wait.hasChanged(),true,id,seq+3);
+  check(poti0Wait.getValue(),0,id,seq+4);
+  check(poti0Wait.getTaperedValue(),0,id,seq+5);
+  check(poti0Wait.getMappedValue(),0,id,seq+6);
+  poti0Wait.setRawValue(51);
+  check(poti0Wait.hasChanged(),true,id,seq+7);
+  check(poti0Wait.getTaperedValue(),256,id,seq+8);
+  check(poti0Wait.getMappedValue(),1,id,seq+9);
+  poti0Wait.setRawValue(102);
+  check(poti0Wait.hasChanged(),true,id,seq+10);
+  check(poti0Wait.getTaperedValue(),512,id,seq+11);
+  check(poti0Wait.getMappedValue(),2,id,seq+12);
+  poti0Wait.setRawValue(563);
+  check(poti0Wait.hasChanged(),false,id,seq+13);
+  check(poti0Wait.getValue(),102,id,seq+14);
+  poti0Wait.setRawValue(564);
+  check(poti0Wait.hasChanged(),true,id,seq+15);
+  check(poti0Wait.getTaperedValue(),768,id,seq+16);
+  check(poti0Wait.getMappedValue(),3,id,seq+17);
+  check(poti0Wait.getMappedPrevValue(),2,id,seq+18);
+
+  // no taper table gives the same result as linear MappedPoti
+  seq = 20;
+  poti0Wait.setTaper(TEST_TAPER_LOG, 0);
+  poti0Wait.setNumMapping(25);
+  mappedPoti.setNumMapping(25);
+  poti0Wait.reset();
+  mappedPoti.reset();
+  for(i = 0 ; i < 1024 ; i++){
+    poti0Wait.setRawValue(i);
+    mappedPoti.setRawValue(i);
+    check(poti0Wait.hasChanged(),mappedPoti.hasChanged(),id,seq+1);
+    check(poti0Wait.getMappedValue(),mappedPoti.getMappedValue(),id,seq+2);
+  }
+
+  // incremental search in both directions and with jumps
+  seq = 30;
+  poti0Wait.setTaper(TEST_TAPER_WORN, 6);
+  poti0Wait.reset();
+  for(i = 0 ; i < 1024 ; i++){
+    poti0Wait.setRawValue(i);
+    poti0Wait.hasChanged();
+    check(poti0Wait.getTaperedValue(),getReferenceTapering(TEST_TAPER_WORN, 6, poti0Wait.getValue()),id,seq+1);
+  }
+  for(i = 1023 ; i >= 0 ; i--){
+    poti0Wait.setRawValue(i);
+    poti0Wait.hasChanged();
+    check(poti0Wait.getTaperedValue(),getReferenceTapering(TEST_TAPER_WORN, 6, poti0Wait.getValue()),id,seq+2);
+  }
+  for(i = 0 ; i < 1024 ; i++){
+    poti0Wait.setRawValue((i * 397) % 1024);
+    poti0Wait.hasChanged();
+    check(poti0Wait.getTaperedValue(),getReferenceTapering(TEST_TAPER_WORN, 6, poti0Wait.getValue()),id,seq+3);
+  }
+
+  // mapping of value arrays
+  seq = 40;
+  poti0Wait.reset();
+  for(i = 0 ; i < 1024 ; i += 64){
+    for(int k = 0 ; k < 64 ; k++){
+      rawValues[k] = i + k;
+    }
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+    for(int k = 0 ; k < 64 ; k++){
+      poti0Wait.setRawValue(i + k);
+      poti0Wait.hasChanged();
+      check(mapValues[k],poti0Wait.getMappedValue(),id,seq+1);
+    }
+  }
+
+  // ranges of uncorrected analog values of the mapping values
+  seq = 50;
+  poti0Wait.setTaper(TEST_TAPER_LOG, 3);
+  poti0Wait.setNumMapping(4);
+  check(poti0Wait.getRawRangeForMapping(0, low, high) && low == 0 && high == 50,true,id,seq+1);
+  check(poti0Wait.getRawRangeForMapping(1, low, high) && low == 51 && high == 101,true,id,seq+2);
+  check(poti0Wait.getRawRangeForMapping(2, low, high) && low == 102 && high == 563,true,id,seq+3);
+  check(poti0Wait.getRawRangeForMapping(3, low, high) && low == 564 && high == 1023,true,id,seq+4);
+  check(poti0Wait.getRawRangeForMapping(4, low, high),false,id,seq+5);
+  // each analog value lies in the range of its mapping value
+  poti0Wait.setTaper(TEST_TAPER_WORN, 6);
+  poti0Wait.setNumMapping(10);
+  for(i = 0 ; i < 1024 ; i += 64){
+    for(int k = 0 ; k < 64 ; k++){
+      rawValues[k] = i + k;
+    }
+    poti0Wait.getMappings(rawValues, mapValues, 64);
+    for(int k = 0 ; k < 64 ; k++){
+      check(poti0Wait.getRawRangeForMapping(mapValues[k], low, high),true,id,seq+6);
+      check(low <= i + k && i + k <= high,true,id,seq+7);
+    }
+  }
+
+  // performance
+
+  Serial.println("\nPerformance Tapered:");
+
+  Serial.print("1024 * hasChanged(), 6 points, mapping 25: ");
+  poti0Wait.setTaper(TEST_TAPER_WORN, 6);
+  poti0Wait.setNumMapping(25);
+  poti0Wait.reset();
+  startmicro = micros();
+  for(i = 0 ; i < 1024 ; i++){
+    poti0Wait.setRawValue(i);
+    poti0Wait.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
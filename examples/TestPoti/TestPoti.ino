@@ -3,6 +3,10 @@
   under the MIT License (MIT)
 */
 
+// virtual clock for the exact timing tests, real time while 0 (see Common.h)
+unsigned long virtualMillis = 0;
+#define POTI_MILLIS() (virtualMillis > 0 ? virtualMillis : millis())
+
 #include <CenteredPoti.h>
 #include "Common.h"
 #include "PotiTests.h"
@@ -10,11 +14,34 @@
 #include "MappedPotiTests.h"
 #include "HalfShiftMappedPotiTests.h"
 #include "CenteredPotiTests.h"
+#include "StablePotiBankTests.h"
+#include "TaperedPotiTests.h"
+#include "MuxPotiSourceTests.h"
+#include "SpiAdcPotiSourceTests.h"
+#include "SharedPotiSourceTests.h"
+#include "MultiMappedPotiTests.h"
+#include "WideMappedPotiTests.h"
+#include "VelocityPotiTests.h"
+#include "TimestampedPotiTests.h"
+#include "SnapshotPotiTests.h"
+#include "PotiCollectionTests.h"
+#include "HistoryPotiTests.h"
+#include "SettledPotiTests.h"
+#include "PotiSchedulerTests.h"
+#include "ThresholdPotiTests.h"
 
 /*
   Example that tests the functionality
-  of Poti, StablePoti, MappedPoti and
-  CenteredPoti classes. Several checks and
+  of Poti, StablePoti, MappedPoti,
+  CenteredPoti, HalfShiftMappedPoti,
+  StablePotiBank, TaperedPoti,
+  MultiMappedPoti and WideMappedPoti
+  classes, of the PotiCollection and
+  PotiScheduler, of the MuxPotiSource,
+  SpiAdcPotiSource and SharedPotiSource
+  and of the VelocityPoti, TimestampedPoti,
+  SnapshotPoti, HistoryPoti, SettledPoti
+  and ThresholdPoti templates. Several checks and
   performance measurements are done
   continously in the loop.
 
@@ -37,5 +64,20 @@ void loop() {
   doMappedPotiTest(ID_MAPPEDTEST);
   doCenteredPotiTest(ID_CENTEREDTEST);
   doHalfShiftMappedPotiTest(ID_HALFSHIFTMAPPEDTEST);
+  doStablePotiBankTest(ID_STABLEBANKTEST);
+  doTaperedPotiTest(ID_TAPEREDTEST);
+  doMuxPotiSourceTest(ID_MUXSOURCETEST);
+  doSpiAdcPotiSourceTest(ID_SPIADCSOURCETEST);
+  doSharedPotiSourceTest(ID_SHAREDSOURCETEST);
+  doMultiMappedPotiTest(ID_MULTIMAPPEDTEST);
+  doWideMappedPotiTest(ID_WIDEMAPPEDTEST);
+  doVelocityPotiTest(ID_VELOCITYTEST);
+  doTimestampedPotiTest(ID_TIMESTAMPEDTEST);
+  doSnapshotPotiTest(ID_SNAPSHOTTEST);
+  doPotiCollectionTest(ID_COLLECTIONTEST);
+  doHistoryPotiTest(ID_HISTORYTEST);
+  doSettledPotiTest(ID_SETTLEDTEST);
+  doPotiSchedulerTest(ID_SCHEDULERTEST);
+  doThresholdPotiTest(ID_THRESHOLDTEST);
   delay(3000);
 }
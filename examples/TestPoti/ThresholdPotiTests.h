@@ -0,0 +1,170 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef THRESHOLDPOTITESTS_TESTPOTI
+#define THRESHOLDPOTITESTS_TESTPOTI
+
+#include "Common.h"
+
+void doThresholdPotiTest(int id){  // ID_THRESHOLDTEST = 20
+  ThresholdPoti<TestPoti> poti(INPUT_PIN, 0);
+  ThresholdPoti<TestStablePoti> stablePoti(INPUT_PIN, 0, 4, 0);
+  TestPoti potiRef(INPUT_PIN, 0);
+  unsigned long startmicro = 0;
+  int seq = 0;
+
+  setVirtualMillis(1000);
+
+  // default reports every change
+  poti.setRawValue(100);
+  check(poti.hasChanged(),true,id,seq+1);
+  poti.setRawValue(101);
+  check(poti.hasChanged(),true,id,seq+2);
+  check(poti.getValue(),101,id,seq+3);
+  check(poti.getPrevValue(),100,id,seq+4);
+  check(poti.hasChanged(),false,id,seq+5);
+
+  // only changes of at least minDelta without hold time
+  seq = 10;
+  poti.reset();
+  poti.setChangeThreshold(5, 0);
+  poti.setRawValue(100);
+  check(poti.hasChanged(),true,id,seq+1);
+  poti.setRawValue(104);
+  check(poti.hasChanged(),false,id,seq+2);
+  check(poti.getValue(),100,id,seq+3);
+  check(poti.getPrevValue(),POTI_VALUE_UNDEFINED,id,seq+4);
+  poti.setRawValue(95);
+  check(poti.hasChanged(),true,id,seq+5);
+  check(poti.getValue(),95,id,seq+6);
+  check(poti.getPrevValue(),100,id,seq+7);
+  poti.setRawValue(97);
+  addVirtualMillis(5000);
+  check(poti.hasChanged(),false,id,seq+8);
+  check(poti.getValue(),95,id,seq+9);
+
+  // smaller changes after a steady value for holdMillis
+  seq = 20;
+  poti.setChangeThreshold(5, 10);
+  check(poti.hasChanged(),false,id,seq+1);   // 97 waits from 6000 on
+  addVirtualMillis(9);
+  check(poti.hasChanged(),false,id,seq+2);
+  addVirtualMillis(1);
+  check(poti.hasChanged(),true,id,seq+3);
+  check(poti.getValue(),97,id,seq+4);
+  check(poti.getPrevValue(),95,id,seq+5);
+  check(poti.hasChanged(),false,id,seq+6);
+
+  // each different value restarts the hold time
+  seq = 30;
+  poti.setRawValue(99);
+  check(poti.hasChanged(),false,id,seq+1);   // 99 waits
+  addVirtualMillis(6);
+  poti.setRawValue(98);
+  check(poti.hasChanged(),false,id,seq+2);   // 98 waits
+  addVirtualMillis(6);
+  check(poti.hasChanged(),false,id,seq+3);
+  poti.setRawValue(99);
+  check(poti.hasChanged(),false,id,seq+4);   // 99 waits again
+  addVirtualMillis(9);
+  check(poti.hasChanged(),false,id,seq+5);
+  addVirtualMillis(1);
+  check(poti.hasChanged(),true,id,seq+6);
+  check(poti.getValue(),99,id,seq+7);
+  check(poti.getPrevValue(),97,id,seq+8);
+
+  // back to the current value ends the waiting
+  seq = 40;
+  poti.setRawValue(101);
+  check(poti.hasChanged(),false,id,seq+1);   // 101 waits
+  addVirtualMillis(6);
+  poti.setRawValue(99);
+  check(poti.hasChanged(),false,id,seq+2);
+  poti.setRawValue(101);
+  addVirtualMillis(6);
+  check(poti.hasChanged(),false,id,seq+3);   // 101 waits again
+  addVirtualMillis(9);
+  check(poti.hasChanged(),false,id,seq+4);
+  addVirtualMillis(1);
+  check(poti.hasChanged(),true,id,seq+5);
+  check(poti.getValue(),101,id,seq+6);
+  // large change is reported immediately while a smaller one waits
+  poti.setRawValue(103);
+  check(poti.hasChanged(),false,id,seq+7);
+  poti.setRawValue(300);
+  check(poti.hasChanged(),true,id,seq+8);
+  check(poti.getValue(),300,id,seq+9);
+  check(poti.getPrevValue(),101,id,seq+10);
+
+  // waiting with read cycle, no new measurement between the cycles
+  seq = 50;
+  poti.setReadCycleMillis(4);
+  poti.setRawValue(302);
+  addVirtualMillis(4);
+  check(poti.hasChanged(),false,id,seq+1);   // 302 waits
+  addVirtualMillis(2);
+  check(poti.hasChanged(),false,id,seq+2);
+  addVirtualMillis(8);
+  check(poti.hasChanged(),true,id,seq+3);    // no measurement, but steady
+  check(poti.getValue(),302,id,seq+4);
+  poti.setReadCycleMillis(0);
+
+  // stabilized values with weighting
+  seq = 60;
+  stablePoti.setChangeThreshold(10, 5);
+  stablePoti.setRawValue(500);
+  check(stablePoti.hasChanged(),true,id,seq+1);
+  check(stablePoti.getValue(),500,id,seq+2);
+  stablePoti.setRawValue(509);
+  addVirtualMillis(1);
+  check(stablePoti.hasChanged(),false,id,seq+3);   // 505 waits
+  addVirtualMillis(1);
+  check(stablePoti.hasChanged(),false,id,seq+4);   // 507 waits
+  addVirtualMillis(1);
+  check(stablePoti.hasChanged(),false,id,seq+5);   // 508 waits
+  addVirtualMillis(1);
+  check(stablePoti.hasChanged(),false,id,seq+6);   // 509 waits
+  addVirtualMillis(4);
+  check(stablePoti.hasChanged(),false,id,seq+7);   // 509 steady
+  addVirtualMillis(1);
+  check(stablePoti.hasChanged(),true,id,seq+8);
+  check(stablePoti.getValue(),509,id,seq+9);
+  stablePoti.setRawValue(600);
+  addVirtualMillis(1);
+  check(stablePoti.hasChanged(),true,id,seq+10);   // 555
+  check(stablePoti.getValue(),555,id,seq+11);
+  check(stablePoti.getPrevValue(),509,id,seq+12);
+
+  // identical values as the class P with default threshold
+  seq = 80;
+  poti.reset();
+  poti.setChangeThreshold(1, 0);
+  for(int i = 0 ; i < 200 ; i++){
+    poti.setRawValue((i * 37) % 50);
+    potiRef.setRawValue((i * 37) % 50);
+    check(poti.hasChanged(),potiRef.hasChanged(),id,seq+1);
+    check(poti.getValue(),potiRef.getValue(),id,seq+2);
+    check(poti.getPrevValue(),potiRef.getPrevValue(),id,seq+3);
+  }
+
+  useRealMillis();
+
+  // performance
+
+  Serial.println("\nPerformance Threshold:");
+
+  Serial.print("1024 * hasChanged() with threshold and hold time: ");
+  poti.reset();
+  poti.setChangeThreshold(8, 100);
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    poti.setRawValue(i);
+    poti.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
@@ -0,0 +1,63 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef TIMESTAMPEDPOTITESTS_TESTPOTI
+#define TIMESTAMPEDPOTITESTS_TESTPOTI
+
+#include "Common.h"
+
+void doTimestampedPotiTest(int id){  // ID_TIMESTAMPEDTEST = 13
+  TimestampedPoti<TestPoti> poti0Wait(INPUT_PIN, 0);
+  TimestampedPoti<TestStablePoti> stablePoti(INPUT_PIN, 0, 0, 2);
+  unsigned long startmicro = 0;
+  int seq = 0;
+
+  setVirtualMillis(1000);
+  check(poti0Wait.getChangeMillis() == 0,true,id,seq+1);
+  poti0Wait.setRawValue(100);
+  check(poti0Wait.hasChanged(),true,id,seq+2);
+  check(poti0Wait.getChangeMillis() == 1000,true,id,seq+3);
+  addVirtualMillis(5);
+  check(poti0Wait.hasChanged(),false,id,seq+4);
+  check(poti0Wait.getChangeMillis() == 1000,true,id,seq+5);
+  poti0Wait.setRawValue(200);
+  check(poti0Wait.hasChanged(),true,id,seq+6);
+  check(poti0Wait.getChangeMillis() == 1005,true,id,seq+7);
+  poti0Wait.reset();
+  check(poti0Wait.getChangeMillis() == 0,true,id,seq+8);
+
+  // timestamp of the last measurement of the average
+  seq = 10;
+  stablePoti.setRawValue(500);
+  check(stablePoti.hasChanged(),true,id,seq+1);
+  check(stablePoti.getChangeMillis() == 1005,true,id,seq+2);
+  stablePoti.setRawValue(600);
+  addVirtualMillis(2);
+  check(stablePoti.hasChanged(),false,id,seq+3);
+  addVirtualMillis(1);
+  check(stablePoti.hasChanged(),false,id,seq+4);
+  check(stablePoti.hasChanged(),false,id,seq+5);
+  addVirtualMillis(1);
+  check(stablePoti.hasChanged(),true,id,seq+6);
+  check(stablePoti.getValue(),600,id,seq+7);
+  check(stablePoti.getChangeMillis() == 1009,true,id,seq+8);
+  useRealMillis();
+
+  // performance
+
+  Serial.println("\nPerformance Timestamped:");
+
+  Serial.print("1024 * hasChanged(): ");
+  poti0Wait.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    poti0Wait.setRawValue(i);
+    poti0Wait.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
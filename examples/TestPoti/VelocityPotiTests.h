@@ -0,0 +1,146 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef VELOCITYPOTITESTS_TESTPOTI
+#define VELOCITYPOTITESTS_TESTPOTI
+
+#include "Common.h"
+
+// check of long values, velocity and acceleration exceed int with AVR
+void checkLong(long value, long ref, int id, int seq){
+  check(value == ref,true,id,seq);
+}
+
+// expected value per second, limited to the range of long like VelocityPoti
+long getLimitedPerSecond(long long value){
+  if(value > LONG_MAX){
+    return LONG_MAX;
+  }
+  if(value < -LONG_MAX){
+    return -LONG_MAX;
+  }
+  return (long)value;
+}
+
+void doVelocityPotiTest(int id){  // ID_VELOCITYTEST = 12
+  VelocityPoti<TestPoti> poti0Wait(INPUT_PIN, 0);
+  VelocityPoti<TestMappedPoti> mappedPoti(INPUT_PIN, 0, 0, 0, 10, 0);
+  unsigned long startmicro = 0;
+  int seq = 0;
+
+  setVirtualMillis(1000);
+  poti0Wait.setRawValue(100);
+  check(poti0Wait.hasChanged(),true,id,seq+1);
+  checkLong(poti0Wait.getVelocity(),0,id,seq+2);
+  checkLong(poti0Wait.getAcceleration(),0,id,seq+3);
+
+  // 100 values in 10 millis, then 50 values in 10 millis
+  seq = 10;
+  addVirtualMillis(10);
+  poti0Wait.setRawValue(200);
+  check(poti0Wait.hasChanged(),true,id,seq+1);
+  checkLong(poti0Wait.getVelocity(),10000,id,seq+2);
+  checkLong(poti0Wait.getAcceleration(),1000000,id,seq+3);
+  addVirtualMillis(10);
+  poti0Wait.setRawValue(250);
+  check(poti0Wait.hasChanged(),true,id,seq+4);
+  checkLong(poti0Wait.getVelocity(),5000,id,seq+5);
+  checkLong(poti0Wait.getAcceleration(),-500000,id,seq+6);
+  check(poti0Wait.hasChanged(),false,id,seq+7);
+  checkLong(poti0Wait.getVelocity(),5000,id,seq+8);
+  // 7 values in 3 millis with rounding towards 0
+  addVirtualMillis(3);
+  poti0Wait.setRawValue(257);
+  check(poti0Wait.hasChanged(),true,id,seq+9);
+  checkLong(poti0Wait.getVelocity(),2333,id,seq+10);
+  checkLong(poti0Wait.getAcceleration(),-889000,id,seq+11);
+
+  // stopped
+  seq = 30;
+  addVirtualMillis(VELOCITY_POTI_STOP_MILLIS - 1);
+  check(poti0Wait.hasChanged(),false,id,seq+1);
+  checkLong(poti0Wait.getVelocity(),2333,id,seq+2);
+  addVirtualMillis(1);
+  check(poti0Wait.hasChanged(),false,id,seq+3);
+  checkLong(poti0Wait.getVelocity(),0,id,seq+4);
+  checkLong(poti0Wait.getAcceleration(),0,id,seq+5);
+
+  // first change after a stop uses VELOCITY_POTI_START_MILLIS, not the time at rest
+  seq = 40;
+  addVirtualMillis(5000);
+  poti0Wait.setRawValue(157);
+  check(poti0Wait.hasChanged(),true,id,seq+1);
+  checkLong(poti0Wait.getVelocity(),-100000L / VELOCITY_POTI_START_MILLIS,id,seq+2);
+  checkLong(poti0Wait.getAcceleration(),0,id,seq+3);
+  // slow movement without stop
+  addVirtualMillis(VELOCITY_POTI_STOP_MILLIS - 50);
+  poti0Wait.setRawValue(142);
+  check(poti0Wait.hasChanged(),true,id,seq+4);
+  checkLong(poti0Wait.getVelocity(),-15000L / (VELOCITY_POTI_STOP_MILLIS - 50),id,seq+5);
+
+  // smoothing
+  seq = 50;
+  poti0Wait.setVelocitySmoothing(1);
+  addVirtualMillis(10);
+  poti0Wait.setRawValue(42);
+  check(poti0Wait.hasChanged(),true,id,seq+1);
+  checkLong(poti0Wait.getVelocity(),-5050,id,seq+2);
+  checkLong(poti0Wait.getAcceleration(),-495000,id,seq+3);
+  poti0Wait.reset();
+  checkLong(poti0Wait.getVelocity(),0,id,seq+4);
+  checkLong(poti0Wait.getAcceleration(),0,id,seq+5);
+  check(poti0Wait.getValue(),POTI_VALUE_UNDEFINED,id,seq+6);
+
+  // velocity of mapping changes
+  seq = 60;
+  mappedPoti.setRawValue(0);
+  check(mappedPoti.hasChanged(),true,id,seq+1);
+  addVirtualMillis(10);
+  mappedPoti.setRawValue(50);
+  check(mappedPoti.hasChanged(),false,id,seq+2);
+  mappedPoti.setRawValue(1023);
+  check(mappedPoti.hasChanged(),true,id,seq+3);
+  checkLong(mappedPoti.getVelocity(),102300,id,seq+4);
+  checkLong(mappedPoti.getAcceleration(),10230000,id,seq+5);
+
+  // reversal of 12 bit values within 1 ms, acceleration limited without overflow
+  seq = 70;
+  poti0Wait.setVelocitySmoothing(0);
+  poti0Wait.reset();
+  poti0Wait.setRawValue(0);
+  check(poti0Wait.hasChanged(),true,id,seq+1);
+  addVirtualMillis(1);
+  poti0Wait.setRawValue(4095);
+  check(poti0Wait.hasChanged(),true,id,seq+2);
+  checkLong(poti0Wait.getVelocity(),4095000,id,seq+3);
+  checkLong(poti0Wait.getAcceleration(),getLimitedPerSecond(4095000LL * 1000),id,seq+4);
+  addVirtualMillis(1);
+  poti0Wait.setRawValue(0);
+  check(poti0Wait.hasChanged(),true,id,seq+5);
+  checkLong(poti0Wait.getVelocity(),-4095000,id,seq+6);
+  checkLong(poti0Wait.getAcceleration(),getLimitedPerSecond(-8190000LL * 1000),id,seq+7);
+  addVirtualMillis(1);
+  poti0Wait.setRawValue(1);
+  check(poti0Wait.hasChanged(),true,id,seq+8);
+  checkLong(poti0Wait.getAcceleration(),getLimitedPerSecond(4096000LL * 1000),id,seq+9);
+
+  useRealMillis();
+
+  // performance
+
+  Serial.println("\nPerformance Velocity:");
+
+  Serial.print("1024 * hasChanged(): ");
+  poti0Wait.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    poti0Wait.setRawValue(i);
+    poti0Wait.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
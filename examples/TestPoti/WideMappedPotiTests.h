@@ -0,0 +1,190 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#ifndef WIDEMAPPEDPOTITESTS_TESTPOTI
+#define WIDEMAPPEDPOTITESTS_TESTPOTI
+
+#include "Common.h"
+
+// mapping values and boundaries of all analog values
+void checkWideMapping(uint16_t numMapping, int maxAnalogVal, int id, int seq){
+  uint16_t mapValue, prevMapValue = 0;
+
+  check(WideMappedPoti::calcWideMapping(0, numMapping, maxAnalogVal),0,id,seq+1);
+  check(WideMappedPoti::calcWideMapping(maxAnalogVal, numMapping, maxAnalogVal),
+    (numMapping > maxAnalogVal ? maxAnalogVal * (long)numMapping / (maxAnalogVal + 1) : numMapping - 1),id,seq+2);
+  check(WideMappedPoti::calcWideBoundary(numMapping, numMapping, maxAnalogVal),maxAnalogVal + 1,id,seq+3);
+
+  for(int i = 0 ; i <= maxAnalogVal ; i++){
+    mapValue = WideMappedPoti::calcWideMapping(i, numMapping, maxAnalogVal);
+    if(mapValue < prevMapValue || mapValue >= numMapping){
+      check(mapValue,prevMapValue,id,seq+4);
+    }
+    if(WideMappedPoti::calcWideBoundary(mapValue, numMapping, maxAnalogVal) > i){
+      check(WideMappedPoti::calcWideBoundary(mapValue, numMapping, maxAnalogVal),i,id,seq+5);
+    }
+    if(WideMappedPoti::calcWideBoundary(mapValue + 1, numMapping, maxAnalogVal) <= i){
+      check(WideMappedPoti::calcWideBoundary(mapValue + 1, numMapping, maxAnalogVal),i + 1,id,seq+6);
+    }
+    prevMapValue = mapValue;
+  }
+}
+
+void doWideMappedPotiTest(int id){  // ID_WIDEMAPPEDTEST = 14
+  TestWideMappedPoti poti2(INPUT_PIN, 0, 0, 0, 1);
+  TestWideMappedPoti poti1024(INPUT_PIN, 0, 0, 0, 1024);
+  TestWideMappedPoti poti4096(INPUT_PIN, 0, 0, 0, 5000);
+  TestWideMappedPoti poti100(INPUT_PIN, 0, 0, 0, 100);
+  TestWideMappedPoti potiWeight(INPUT_PIN, 0, 4, 0, 1024);
+  TestStablePoti stablePoti(INPUT_PIN, 0, 4, 0);
+  TestMappedPoti mapped100(INPUT_PIN, 0, 0, 0, 100, 0);
+  unsigned long startmicro = 0;
+  int seq = 0;
+  int value, low, high;
+
+  // corrected configurations
+  check(poti2.getNumMappingValues(),2,id,seq+1);
+  check(poti4096.getNumMappingValues(),4096,id,seq+2);
+  check(poti1024.getMappedValue(),WIDE_POTI_MAPPING_UNDEFINED,id,seq+3);
+  check(poti1024.getMappedPrevValue(),WIDE_POTI_MAPPING_UNDEFINED,id,seq+4);
+  check(poti1024.getMaxAnalogValue(),1023,id,seq+5);
+  check(poti4096.setMaxAnalogValue(4096),4095,id,seq+6);
+
+  // mapping values and boundaries
+  checkWideMapping(2, 1023, id, 10);
+  checkWideMapping(100, 1023, id, 20);
+  checkWideMapping(1000, 1023, id, 30);
+  checkWideMapping(1024, 1023, id, 40);
+  checkWideMapping(4096, 1023, id, 50);
+  checkWideMapping(3000, 4095, id, 60);
+  checkWideMapping(4096, 4095, id, 70);
+
+  // one mapping value per analog value
+  seq = 80;
+  poti1024.setRawValue(0);
+  check(poti1024.hasChanged(),true,id,seq+1);
+  check(poti1024.getMappedValue(),0,id,seq+2);
+  poti1024.setRawValue(1);
+  check(poti1024.hasChanged(),true,id,seq+3);
+  check(poti1024.getMappedValue(),1,id,seq+4);
+  check(poti1024.getMappedPrevValue(),0,id,seq+5);
+  check(poti1024.hasChanged(),false,id,seq+6);
+  poti1024.setRawValue(1023);
+  check(poti1024.hasChanged(),true,id,seq+7);
+  check(poti1024.getMappedValue(),1023,id,seq+8);
+  check(poti1024.getValue(),1023,id,seq+9);
+  check(poti1024.getPrevValue(),1,id,seq+10);
+
+  // 12 bit analog values
+  seq = 100;
+  poti4096.setRawValue(4095);
+  check(poti4096.hasChanged(),true,id,seq+1);
+  check(poti4096.getMappedValue(),4095,id,seq+2);
+  poti4096.setRawValue(2048);
+  check(poti4096.hasChanged(),true,id,seq+3);
+  check(poti4096.getMappedValue(),2048,id,seq+4);
+  check(poti4096.getMappedPrevValue(),4095,id,seq+5);
+  poti4096.reset();
+  check(poti4096.getMappedValue(),WIDE_POTI_MAPPING_UNDEFINED,id,seq+6);
+  check(poti4096.hasChanged(),true,id,seq+7);
+  check(poti4096.getMappedPrevValue(),WIDE_POTI_MAPPING_UNDEFINED,id,seq+8);
+
+  // changes only within the cached range of the mapping value
+  seq = 110;
+  poti100.setRawValue(15);
+  check(poti100.hasChanged(),true,id,seq+1);
+  check(poti100.getMappedValue(),1,id,seq+2);
+  poti100.setRawValue(11);
+  check(poti100.hasChanged(),false,id,seq+3);
+  poti100.setRawValue(20);
+  check(poti100.hasChanged(),false,id,seq+4);
+  check(poti100.getValue(),15,id,seq+5);
+  poti100.setRawValue(21);
+  check(poti100.hasChanged(),true,id,seq+6);
+  check(poti100.getMappedValue(),2,id,seq+7);
+  poti100.setRawValue(10);
+  check(poti100.hasChanged(),true,id,seq+8);
+  check(poti100.getMappedValue(),0,id,seq+9);
+
+  // hysteresis at the mapping boundaries
+  seq = 120;
+  poti100.reset();
+  poti100.setHysteresis(3);
+  poti100.setRawValue(15);
+  check(poti100.hasChanged(),true,id,seq+1);
+  poti100.setRawValue(23);
+  check(poti100.hasChanged(),false,id,seq+2);
+  poti100.setRawValue(24);
+  check(poti100.hasChanged(),true,id,seq+3);
+  check(poti100.getMappedValue(),2,id,seq+4);
+  poti100.setRawValue(18);
+  check(poti100.hasChanged(),false,id,seq+5);
+  poti100.setRawValue(17);
+  check(poti100.hasChanged(),true,id,seq+6);
+  check(poti100.getMappedValue(),1,id,seq+7);
+  poti100.setRawValue(900);
+  check(poti100.hasChanged(),true,id,seq+8);
+  check(poti100.getMappedValue(),87,id,seq+9);
+
+  // same stabilization as StablePoti
+  seq = 130;
+  for(int i = 0 ; i < 200 ; i++){
+    value = (i * 97 + (i & 0x03) * 5) % 1024;
+    potiWeight.setRawValue(value);
+    stablePoti.setRawValue(value);
+    check(potiWeight.hasChanged(),stablePoti.hasChanged(),id,seq+1);
+    check(potiWeight.getValue(),stablePoti.getValue(),id,seq+2);
+    check(potiWeight.getMappedValue(),stablePoti.getValue(),id,seq+3);
+  }
+
+  // ranges of analog values of the mapping values
+  seq = 140;
+  check(poti100.getRawRangeForMapping(1, low, high),true,id,seq+1);
+  check(low,11,id,seq+2);
+  check(high,20,id,seq+3);
+  check(poti100.getRawRangeForMapping(99, low, high),true,id,seq+4);
+  check(low,1014,id,seq+5);
+  check(high,1023,id,seq+6);
+  check(poti100.getRawRangeForMapping(100, low, high),false,id,seq+7);
+  check(poti4096.getRawRangeForMapping(4095, low, high),true,id,seq+8);
+  check(low,4095,id,seq+9);
+  check(high,4095,id,seq+10);
+
+  // performance
+
+  Serial.println("\nPerformance WideMappedPoti:");
+
+  Serial.print("4096 * hasChanged() with 4096 mapping values, numAvg 0, prevWeight 0: ");
+  poti4096.reset();
+  startmicro = micros();
+  for(int i = 0 ; i < 4096 ; i++){
+    poti4096.setRawValue(i);
+    poti4096.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * hasChanged() with 100 mapping values, numAvg 0, prevWeight 0: ");
+  poti100.reset();
+  poti100.setHysteresis(0);
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    poti100.setRawValue(i);
+    poti100.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+
+  Serial.print("1024 * hasChanged() of MappedPoti with 100 mapping values: ");
+  startmicro = micros();
+  for(int i = 0 ; i < 1024 ; i++){
+    mapped100.setRawValue(i);
+    mapped100.hasChanged();
+  }
+  Serial.print(micros() - startmicro);
+  Serial.println(" micros");
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <ThresholdPoti.h>
+#include <StablePoti.h>
+
+/*
+  Example to reduce the number of reported changes of a
+  noisy potentiometer without reducing the resolution of
+  the analog values.
+
+  Changes of at least MIN_DELTA analog values are written
+  at once. Smaller changes are only written, when the
+  value has been steady for HOLD_MILLIS milliseconds. So
+  the noise at rest doesn't produce a stream of changes,
+  but a slow fine adjustment is still reported.
+
+  Prerequisite is an potentiometer connected
+  with variable voltage pin to analog input
+  pin. Output will be written to Serial.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define READ_CYCLE_MILLIS 10          // minimum difference between two actual read of analog raw value
+#define WEIGHT_PREV 4                 // weight of previous value in calculating new value
+#define MIN_DELTA 8                   // minimum difference for reporting a change at once
+#define HOLD_MILLIS 300               // milliseconds of a steady value for reporting smaller changes
+
+ThresholdPoti<StablePoti> pot = ThresholdPoti<StablePoti>(INPUT_PIN, READ_CYCLE_MILLIS, WEIGHT_PREV, 0);
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  pot.setChangeThreshold(MIN_DELTA, HOLD_MILLIS);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  if(pot.hasChanged()){
+    Serial.print("curVal=");
+    Serial.print(pot.getValue());
+    Serial.print(", prevVal=");
+    Serial.println(pot.getPrevValue());
+  }
+}
@@ -0,0 +1,470 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+// virtual clock of the simulation, must be defined before including the Poti classes
+unsigned long virtualMillis = 1;
+#define POTI_MILLIS() virtualMillis
+
+#include <CenteredPoti.h>
+#include <ThresholdPoti.h>
+
+/*
+  Example for finding suitable constructor parameters of
+  StablePoti, MappedPoti and CenteredPoti for a given noise
+  of the analog values, without trial and error on hardware.
+
+  The potentiometer is simulated on a virtual clock (defined
+  by POTI_MILLIS() before the include) with one of the noise
+  profiles (selected by NOISE_PROFILE):
+  - NOISE_GAUSSIAN: normal distributed noise, approximated by
+                    the sum of four uniform values
+  - NOISE_SPIKES:   low noise with single spikes
+  - NOISE_DRIFT:    uniform noise with a slow drift
+  - NOISE_TRACE:    recorded noise, given as deviations of the
+                    analog values from their average at rest
+                    in NOISE_TRACE_VALUES (replace the example
+                    values by an own recording)
+
+  For each class the parameters readCycleMillis, weightPrev,
+  addNumRawAvg, stretch and a threshold (minDelta of
+  setChangeThreshold() for ThresholdPoti<StablePoti>, setHysteresis() for
+  the mapped classes) are searched. A configuration is valid,
+  when hasChanged() reports no change while the potentiometer
+  rests at several positions (spurious changes). For the
+  mapped classes the rest positions are mapping boundaries
+  (lowest analog value of getRawRangeForMapping()), where
+  the noise crosses the boundary as worst case for the
+  hysteresis. For the
+  valid configurations the step response latency is measured,
+  the time from a jump of the analog value from STEP_FROM to
+  STEP_TO until the value (StablePoti, within STABLE_TOLERANCE
+  plus threshold) or mapping value of the noise free step is
+  reported, as worst case of several trials. For each
+  combination of the other parameters only the smallest
+  valid weightPrev is measured, because higher weights only
+  increase the latency.
+
+  The configuration with the lowest latency is written to
+  Serial as constructor call. The search takes some minutes
+  with AVR. No potentiometer is necessary.
+*/
+
+#define NOISE_GAUSSIAN 0
+#define NOISE_SPIKES 1
+#define NOISE_DRIFT 2
+#define NOISE_TRACE 3
+
+#define NOISE_PROFILE NOISE_GAUSSIAN  // noise profile of the simulated potentiometer
+#define NOISE_AMPLITUDE 2             // noise amplitude in analog values (not for NOISE_TRACE)
+#define SPIKE_AMPLITUDE 30            // amplitude of the spikes of NOISE_SPIKES
+#define DRIFT_MILLIS 4000             // period of the drift of NOISE_DRIFT
+
+#define NUM_MAPPING 10                // number of mapping values of MappedPoti
+#define NUM_CENTERED_MAPPING 11       // number of mapping values of CenteredPoti
+#define CENTER_TOL 20                 // center tolerance of CenteredPoti
+#define STABLE_TOLERANCE 4            // tolerance of StablePoti values for reaching the target
+
+#define STEP_FROM 200                 // analog value before the step
+#define STEP_TO 800                   // analog value after the step
+#define NUM_STEP_TRIALS 8             // trials with different times of the step
+#define SETTLE_MILLIS 500             // simulated time until the values are stable
+#define REST_MILLIS 1500              // simulated time at each rest position
+#define MAX_LATENCY 2000              // maximum simulated time after the step
+#define NUM_REST_POSITIONS 5          // number of rest positions spread over the analog values
+
+// searched parameter values
+const uint8_t READ_CYCLES[] = {0, 5, 10, 20};
+const uint8_t WEIGHTS[] = {0, 1, 2, 3, 4, 6, 8, 12};
+const uint8_t AVERAGES[] = {0, 1, 3, 7};
+const uint8_t STRETCHES[] = {0, 10, 20};
+const uint8_t THRESHOLDS[] = {0, 2, 4, 8, 16};
+
+// example of a recorded noise trace, deviations from the average at rest
+const int8_t NOISE_TRACE_VALUES[] PROGMEM = {
+   0,  1, -1,  0,  2,  0, -1, -2,  1,  0,  0,  1, -1,  3,  0, -1,
+   1,  0, -2,  0,  1,  1,  0, -1,  0,  2, -1,  0,  0, -3,  1,  0,
+  -1,  0,  1,  0,  0, -1,  2,  1,  0, -1,  0,  0,  1, -2,  0,  1,
+   0, -1,  0,  2,  0,  0, -1,  1,  0, -1,  1,  0, -2,  0,  1,  0
+};
+
+
+/*
+  Configuration of a simulated potentiometer.
+*/
+struct TunerConfig {
+  uint8_t readCycleMillis;
+  uint8_t weightPrev;
+  uint8_t addNumRawAvg;
+  uint8_t stretch;
+  uint8_t threshold;
+};
+
+
+// simulated analog value without noise
+int simValue;
+// switch for noise free simulation
+bool noiseEnabled;
+// state of the noise generation
+uint16_t noiseSeed;
+uint8_t traceIndex;
+
+
+// returns the next pseudo random value (xorshift)
+uint16_t nextRandom(){
+  noiseSeed ^= noiseSeed << 7;
+  noiseSeed ^= noiseSeed >> 9;
+  noiseSeed ^= noiseSeed << 8;
+  return noiseSeed;
+}
+
+
+// returns a uniform random value from -amplitude to amplitude
+int getUniform(int amplitude){
+  return (int)(nextRandom() % (2 * amplitude + 1)) - amplitude;
+}
+
+
+// restarts the noise, so that each simulation gets the same noise
+void resetNoise(){
+  noiseSeed = 1;
+  traceIndex = 0;
+}
+
+
+// returns the simulated analog value with noise at the current virtual time
+int getSimValue(){
+  long value = simValue;
+
+  if(!noiseEnabled){
+    return value;
+  }
+
+#if NOISE_PROFILE == NOISE_GAUSSIAN
+  value += (getUniform(NOISE_AMPLITUDE) + getUniform(NOISE_AMPLITUDE)
+    + getUniform(NOISE_AMPLITUDE) + getUniform(NOISE_AMPLITUDE)) / 2;
+#elif NOISE_PROFILE == NOISE_SPIKES
+  value += getUniform(1);
+  if((nextRandom() & 0x3F) == 0){
+    value += getUniform(SPIKE_AMPLITUDE);
+  }
+#elif NOISE_PROFILE == NOISE_DRIFT
+  // triangle from -NOISE_AMPLITUDE to NOISE_AMPLITUDE
+  long drift = (virtualMillis % DRIFT_MILLIS) * 4 * NOISE_AMPLITUDE / DRIFT_MILLIS;
+  if(drift > 2 * NOISE_AMPLITUDE){
+    drift = 4 * NOISE_AMPLITUDE - drift;
+  }
+  value += drift - NOISE_AMPLITUDE + getUniform(NOISE_AMPLITUDE);
+#else
+  value += (int8_t)pgm_read_byte(&NOISE_TRACE_VALUES[traceIndex]);
+  traceIndex = (traceIndex + 1) % sizeof(NOISE_TRACE_VALUES);
+#endif
+
+  if(value < 0){
+    value = 0;
+  }
+  else if(value > 1023){
+    value = 1023;
+  }
+  return value;
+}
+
+
+// writes the common constructor parameters to Serial
+void printCommonArgs(const char* name, const TunerConfig& config){
+  Serial.print(name);
+  Serial.print("(inputPin, ");
+  Serial.print(config.readCycleMillis);
+  Serial.print(", ");
+  Serial.print(config.weightPrev);
+  Serial.print(", ");
+  Serial.print(config.addNumRawAvg);
+}
+
+
+/*
+  Subclass of class ThresholdPoti<StablePoti> with simulated raw values.
+*/
+class SimStablePoti : public ThresholdPoti<StablePoti> {
+  private:
+    int _tolerance;
+
+  public:
+    SimStablePoti(const TunerConfig& config)
+      : ThresholdPoti<StablePoti>(0, config.readCycleMillis, config.weightPrev, config.addNumRawAvg){
+      setChangeThreshold(config.threshold, 0);
+      _tolerance = STABLE_TOLERANCE + config.threshold;
+    }
+
+    int getRawValue(){
+      return getSimValue();
+    }
+
+    // without mapping boundaries, in the middle of equal parts of the analog values
+    int getRestValue(uint8_t position){
+      return (2 * position + 1) * 1023L / (2 * NUM_REST_POSITIONS);
+    }
+
+    bool isResult(int target){
+      return abs(getValue() - target) <= _tolerance;
+    }
+
+    int getResult(){
+      return getValue();
+    }
+
+    static void printConfig(const TunerConfig& config){
+      printCommonArgs(config.threshold > 1 ? "ThresholdPoti<StablePoti>" : "StablePoti", config);
+      Serial.print(")");
+      if(config.threshold > 1){
+        Serial.print(" with setChangeThreshold(");
+        Serial.print(config.threshold);
+        Serial.print(", 0)");
+      }
+    }
+};
+
+
+/*
+  Subclass of class MappedPoti with simulated raw values.
+*/
+class SimMappedPoti : public MappedPoti {
+  public:
+    SimMappedPoti(const TunerConfig& config)
+      : MappedPoti(0, config.readCycleMillis, config.weightPrev, config.addNumRawAvg,
+          NUM_MAPPING, config.stretch){
+      setHysteresis(config.threshold);
+    }
+
+    int getRawValue(){
+      return getSimValue();
+    }
+
+    // lowest analog value of a mapping value, boundary to the previous one
+    int getRestValue(uint8_t position){
+      int low, high;
+      getRawRangeForMapping(1 + position * (getNumMappingValues() - 2) / (NUM_REST_POSITIONS - 1), low, high);
+      return low;
+    }
+
+    bool isResult(int target){
+      return getMappedValue() == target;
+    }
+
+    int getResult(){
+      return getMappedValue();
+    }
+
+    static void printConfig(const TunerConfig& config){
+      printCommonArgs("MappedPoti", config);
+      Serial.print(", ");
+      Serial.print(NUM_MAPPING);
+      Serial.print(", ");
+      Serial.print(config.stretch);
+      Serial.print(")");
+      if(config.threshold > 0){
+        Serial.print(" with setHysteresis(");
+        Serial.print(config.threshold);
+        Serial.print(")");
+      }
+    }
+};
+
+
+/*
+  Subclass of class CenteredPoti with simulated raw values.
+*/
+class SimCenteredPoti : public CenteredPoti {
+  public:
+    SimCenteredPoti(const TunerConfig& config)
+      : CenteredPoti(0, config.readCycleMillis, config.weightPrev, config.addNumRawAvg,
+          NUM_CENTERED_MAPPING, config.stretch, CENTER_TOL, 0){
+      setHysteresis(config.threshold);
+    }
+
+    int getRawValue(){
+      return getSimValue();
+    }
+
+    // lowest analog value of a mapping value, boundary to the previous one
+    int getRestValue(uint8_t position){
+      int low, high;
+      getRawRangeForMapping(1 + position * (getNumMappingValues() - 2) / (NUM_REST_POSITIONS - 1), low, high);
+      return low;
+    }
+
+    bool isResult(int target){
+      return getMappedValue() == target;
+    }
+
+    int getResult(){
+      return getMappedValue();
+    }
+
+    static void printConfig(const TunerConfig& config){
+      printCommonArgs("CenteredPoti", config);
+      Serial.print(", ");
+      Serial.print(NUM_CENTERED_MAPPING);
+      Serial.print(", ");
+      Serial.print(config.stretch);
+      Serial.print(", ");
+      Serial.print(CENTER_TOL);
+      Serial.print(", 0)");
+      if(config.threshold > 0){
+        Serial.print(" with setHysteresis(");
+        Serial.print(config.threshold);
+        Serial.print(")");
+      }
+    }
+};
+
+
+// simulates the time until the values are stable
+template<class S>
+void settle(S& poti, int value){
+  simValue = value;
+  for(uint16_t t = 0 ; t < SETTLE_MILLIS ; t++){
+    virtualMillis++;
+    poti.hasChanged();
+  }
+}
+
+
+/*
+  Simulates one configuration and returns the worst case step latency
+  in milliseconds or -1, if the configuration reports spurious changes
+  at rest or doesn't reach the target.
+*/
+template<class S>
+long evaluate(const TunerConfig& config){
+  long latency, maxLatency = 0;
+  unsigned long stepMillis;
+  int target;
+
+  virtualMillis = 1000;
+
+  // result of the step without noise
+  noiseEnabled = false;
+  {
+    S poti(config);
+    settle(poti, STEP_TO);
+    target = poti.getResult();
+  }
+  noiseEnabled = true;
+
+  // no changes at rest
+  for(uint8_t r = 0 ; r < NUM_REST_POSITIONS ; r++){
+    S poti(config);
+    resetNoise();
+    settle(poti, poti.getRestValue(r));
+    for(uint16_t t = 0 ; t < REST_MILLIS ; t++){
+      virtualMillis++;
+      if(poti.hasChanged()){
+        return -1;
+      }
+    }
+  }
+
+  // latency of steps at different times within the read cycle
+  for(uint8_t i = 0 ; i < NUM_STEP_TRIALS ; i++){
+    S poti(config);
+    resetNoise();
+    settle(poti, STEP_FROM);
+    for(uint8_t t = 0 ; t < i * 7 ; t++){
+      virtualMillis++;
+      poti.hasChanged();
+    }
+    simValue = STEP_TO;
+    stepMillis = virtualMillis;
+    latency = -1;
+    while(virtualMillis - stepMillis < MAX_LATENCY){
+      virtualMillis++;
+      if(poti.hasChanged() && poti.isResult(target)){
+        latency = virtualMillis - stepMillis;
+        break;
+      }
+    }
+    if(latency < 0){
+      return -1;
+    }
+    if(latency > maxLatency){
+      maxLatency = latency;
+    }
+  }
+  return maxLatency;
+}
+
+
+/*
+  Searches the configuration with the lowest latency for class S and
+  writes it as constructor call to Serial.
+*/
+template<class S>
+void tune(const char* name, uint8_t numStretches){
+  TunerConfig config, best;
+  long latency, bestLatency = -1;
+  unsigned long tested = 0;
+
+  for(uint8_t r = 0 ; r < sizeof(READ_CYCLES) ; r++){
+    for(uint8_t a = 0 ; a < sizeof(AVERAGES) ; a++){
+      for(uint8_t s = 0 ; s < numStretches ; s++){
+        for(uint8_t h = 0 ; h < sizeof(THRESHOLDS) ; h++){
+          config.readCycleMillis = READ_CYCLES[r];
+          config.addNumRawAvg = AVERAGES[a];
+          config.stretch = STRETCHES[s];
+          config.threshold = THRESHOLDS[h];
+
+          // smallest weight without spurious changes
+          for(uint8_t w = 0 ; w < sizeof(WEIGHTS) ; w++){
+            config.weightPrev = WEIGHTS[w];
+            tested++;
+            latency = evaluate<S>(config);
+            if(latency >= 0){
+              if(bestLatency < 0 || latency < bestLatency){
+                bestLatency = latency;
+                best = config;
+              }
+              break;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  Serial.print(name);
+  Serial.print(": ");
+  if(bestLatency < 0){
+    Serial.print("no configuration without spurious changes found");
+  }
+  else{
+    S::printConfig(best);
+    Serial.print(", latency millis=");
+    Serial.print(bestLatency);
+  }
+  Serial.print(", tested configurations=");
+  Serial.println(tested);
+}
+
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  Serial.print("noise profile=");
+  Serial.print(NOISE_PROFILE);
+  Serial.print(", noise amplitude=");
+  Serial.println(NOISE_AMPLITUDE);
+
+  tune<SimStablePoti>("StablePoti", 1);
+  tune<SimMappedPoti>("MappedPoti", sizeof(STRETCHES));
+  tune<SimCenteredPoti>("CenteredPoti", sizeof(STRETCHES));
+  Serial.print("\n");
+}
@@ -0,0 +1,97 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <CenteredPoti.h>
+
+/*
+  Example to convert the mapping values of centered
+  potentiometers to the units of an amplifier by
+  unit tables in flash memory (PROGMEM).
+
+  Bass and treble share one table with gains in
+  0.1 dB from -12 dB to +12 dB. The balance uses a
+  table with the gain of the left channel as Q15
+  coefficient (32767 for 1.0), that is reduced when
+  the potentiometer is turned right. The gain of the
+  right channel is the value of the mirrored mapping
+  value, which is read by getUnitValueForMapping().
+  Percent values are possible in the same way.
+
+  The tables are calculated once before compiling,
+  e.g. gain in dB = 2.4 dB * centered mapping value.
+  Then each change needs only a lookup in the table
+  and no floating point calculation.
+
+  Prerequisite are 3 potentiometers connected
+  with variable voltage pin to analog input
+  pins. Output will be written to Serial.
+*/
+
+#define BASS_PIN A5                   // must be analog pin A0 to A7
+#define TREBLE_PIN A6                 // must be analog pin A0 to A7
+#define BALANCE_PIN A7                // must be analog pin A0 to A7
+#define NUM_MAP_VALUES 11             // number of values of the unit tables
+#define READ_CYCLE_MILLIS 50          // minimum difference between two actual read of analog raw value
+#define CENTER_TOL 30                 // tolerance for middle position / center
+
+// gain in 0.1 dB for the centered mapping values -5 to +5
+const int16_t TONE_DB[NUM_MAP_VALUES] PROGMEM = {-120, -96, -72, -48, -24, 0, 24, 48, 72, 96, 120};
+// gain of the left channel as Q15 coefficient for the centered mapping values -5 to +5
+const int16_t BALANCE_LEFT_Q15[NUM_MAP_VALUES] PROGMEM = {
+  32767, 32767, 32767, 32767, 32767, 32767, 26214, 19661, 13107, 6554, 0
+};
+
+CenteredPoti bass = CenteredPoti(BASS_PIN, READ_CYCLE_MILLIS, 0, 0, NUM_MAP_VALUES, 0, CENTER_TOL, 0);
+CenteredPoti treble = CenteredPoti(TREBLE_PIN, READ_CYCLE_MILLIS, 0, 0, NUM_MAP_VALUES, 0, CENTER_TOL, 0);
+CenteredPoti balance = CenteredPoti(BALANCE_PIN, READ_CYCLE_MILLIS, 0, 0, NUM_MAP_VALUES, 0, CENTER_TOL, 0);
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  bass.setUnitTable(TONE_DB);
+  treble.setUnitTable(TONE_DB);
+  balance.setUnitTable(BALANCE_LEFT_Q15);
+}
+
+
+// write a gain in 0.1 dB as dB
+void printGain(const char* name, int16_t gain){
+  Serial.print(name);
+  Serial.print("=");
+  if(gain < 0){
+    Serial.print("-");
+    gain = -gain;
+  }
+  Serial.print(gain / 10);
+  Serial.print(".");
+  Serial.print(gain % 10);
+  Serial.println(" dB");
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  int16_t gain, left, right;
+
+  if(bass.hasChanged() && bass.getCenteredUnitValue(gain)){
+    printGain("bass", gain);
+  }
+
+  if(treble.hasChanged() && treble.getCenteredUnitValue(gain)){
+    printGain("treble", gain);
+  }
+
+  // right channel with the mirrored mapping value
+  if(balance.hasChanged() && balance.getCenteredUnitValue(left)
+     && balance.getUnitValueForMapping(NUM_MAP_VALUES - 1 - balance.getMappedValue(), right)){
+    Serial.print("balance left=");
+    Serial.print(left);
+    Serial.print(", right=");
+    Serial.println(right);
+  }
+}
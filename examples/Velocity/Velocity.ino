@@ -0,0 +1,65 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <VelocityPoti.h>
+#include <StablePoti.h>
+
+/*
+  Example to show the velocity and acceleration
+  of turning the connected potentiometer.
+
+  A fast sweep is detected, when the velocity is
+  higher than SWEEP_VELOCITY analog values per
+  second. When the potentiometer is not turned
+  any more, the velocity becomes 0.
+
+  Prerequisite is an potentiometer connected
+  with variable voltage pin to analog input
+  pin. Output will be written to Serial.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define READ_CYCLE_MILLIS 10          // minimum difference between two actual read of analog raw value
+#define WEIGHT_PREV 4                 // weight of previous value in calculating new value
+#define SWEEP_VELOCITY 3000           // analog values per second for a fast sweep
+
+VelocityPoti<StablePoti> pot = VelocityPoti<StablePoti>(INPUT_PIN, READ_CYCLE_MILLIS, WEIGHT_PREV, 0);
+
+// velocity of the last output
+long lastVelocity = 0;
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  // light smoothing of the velocity
+  pot.setVelocitySmoothing(1);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  // react on changing values by writing the relevant information
+  if(pot.hasChanged()){
+    Serial.print("curVal=");
+    Serial.print(pot.getValue());
+    Serial.print(", velocity=");
+    Serial.print(pot.getVelocity());
+    Serial.print(", acceleration=");
+    Serial.print(pot.getAcceleration());
+    if(pot.getVelocity() > SWEEP_VELOCITY || pot.getVelocity() < -SWEEP_VELOCITY){
+      Serial.print(", fast sweep");
+    }
+    Serial.print("\n");
+  }
+
+  // stopped
+  if(pot.getVelocity() == 0 && lastVelocity != 0){
+    Serial.println("stopped");
+  }
+  lastVelocity = pot.getVelocity();
+}
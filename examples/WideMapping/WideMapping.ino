@@ -0,0 +1,67 @@
+/*
+  Copyright (c) 2025-2026 Kay Kasper
+  under the MIT License (MIT)
+*/
+
+#include <WideMappedPoti.h>
+
+/*
+  Example to generate mapped values with a high
+  resolution, e.g. for MIDI controls with 14 bit
+  values (like pitch bend).
+
+  The analog values are mapped to NUM_MAP_VALUES
+  mapping values. Each mapping value is converted
+  to the 14 bit MIDI value and its two data bytes
+  (MSB and LSB with 7 bit each). With 1024 mapping
+  values each analog value has its own mapping
+  value, so the weighting and the hysteresis at
+  the mapping boundaries prevent the changes of
+  the mapping value, when the potentiometer is not
+  touched.
+
+  Prerequisite is an potentiometer connected
+  with variable voltage pin to analog input
+  pin. Output will be written to Serial.
+*/
+
+#define INPUT_PIN A7                  // must be analog pin A0 to A7
+#define NUM_MAP_VALUES 1024           // max 4096, raw values will be mapped to this number of mapping values
+#define READ_CYCLE_MILLIS 10          // minimum difference between two actual read of analog raw value
+#define WEIGHT_PREV 4                 // weight of previous value in calculating new value
+#define HYSTERESIS 2                  // analog values that a mapping boundary must be crossed
+
+WideMappedPoti pot = WideMappedPoti(INPUT_PIN, READ_CYCLE_MILLIS, WEIGHT_PREV, 0, NUM_MAP_VALUES);
+
+
+// the setup function is called once for initialization
+void setup() {
+  // for showing relevant information
+  Serial.begin(9600);
+
+  pot.setHysteresis(HYSTERESIS);
+}
+
+
+// the loop function runs over and over again forever
+void loop() {
+  unsigned long midiValue;
+
+  // react on changing states by writing the relevant information
+  if(pot.hasChanged()){
+    // scale mapping value to 14 bit
+    midiValue = (unsigned long)pot.getMappedValue() * 16383 / (NUM_MAP_VALUES - 1);
+
+    Serial.print("curVal=");
+    Serial.print(pot.getValue());
+    Serial.print(", curMapVal=");
+    Serial.print(pot.getMappedValue());
+    Serial.print(", midiValue=");
+    Serial.print(midiValue);
+    Serial.print(", MSB=");
+    Serial.print((uint8_t)(midiValue >> 7));
+    Serial.print(", LSB=");
+    Serial.print((uint8_t)(midiValue & 0x7F));
+    Serial.print("\n");
+  }
+}
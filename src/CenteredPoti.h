@@ -55,11 +55,33 @@
   default, then the function setMaxAnalogValue() must be called before
   first use of function hasChanged() to set the real maximum number
   (e.g. 4095).
+
+  The centered mapping values are often converted to a unit of the
+  application, e.g. a gain in dB for treble and bass or a coefficient
+  for balance. Instead of calculating the conversion with floating point
+  numbers after each change, a unit table with the precalculated values
+  can be set by setUnitTable(). The table is stored as int16_t array in
+  flash memory (PROGMEM) with one value per mapping value from -x to +x,
+  so that it doesn't need RAM and can be shared by several CenteredPoti
+  objects. The units are defined by the application, e.g. 0.1 dB,
+  percent or Q15 coefficients (32767 for 1.0). Then getCenteredUnitValue()
+  returns the value of the current mapping value by a simple lookup. The
+  full int16_t range can be used, because the values are returned by a
+  reference parameter and the result tells, if the value is defined.
+
+  Example for 11 mapping values in 0.1 dB from -12 dB to +12 dB:
+
+  const int16_t BASS_DB[] PROGMEM = {-120, -96, -72, -48, -24, 0, 24, 48, 72, 96, 120};
+
+  int16_t gain;
+  if(bass.hasChanged() && bass.getCenteredUnitValue(gain)){
+    setBassGain(gain);
+  }
   
   Advantages:
   - no active waits
   - high performance
-  - memory usage per CenteredPoti instance (27 Byte)
+  - memory usage per CenteredPoti instance (34 Byte with AVR)
   - handling current and previous value
   - value caching enables stable value analysis
   - easy handling in loops with little code
@@ -70,6 +92,8 @@
   - stabilization by mapping analog values
   - compensation for unequal distribution of analog values (optional)
   - transformation of linear analog and mapping values to center based ranges
+  - conversion of mapping values to application units by tables (optional)
+  - hysteresis at the mapping boundaries (optional)
 */
 
 
@@ -81,6 +105,8 @@ class CenteredPoti : public MappedPoti {
     int _centerValLow;
     // high border for centered potentiometers based on parameters centerVal + centerTol
     int _centerValHigh;
+    // unit table in flash memory with numMapping values or NULL
+    const int16_t* _unitTable;
 
   public:
 
@@ -161,6 +187,8 @@ class CenteredPoti : public MappedPoti {
         _centerValLow = centerVal - centerTol;
         _centerValHigh = centerVal + centerTol;
       }
+
+      _unitTable = NULL;
     }
 
 
@@ -190,7 +218,14 @@ class CenteredPoti : public MappedPoti {
       }
 
       mapValue = MappedPoti::getMapping(rawValue, _centerValLow, _centerValHigh);
-      
+
+      // boundary not crossed by more than the hysteresis?
+      if(isHysteresisRelevant(mapValue)){
+        if(MappedPoti::getMapping(getHysteresisValue(rawValue, mapValue), _centerValLow, _centerValHigh) == _curMapValue){
+          return false;
+        }
+      }
+
       // Mapping-Wechsel?
       if(mapValue != _curMapValue){
         _prevValue = _curValue;
@@ -203,6 +238,61 @@ class CenteredPoti : public MappedPoti {
     }
 
 
+    /*
+      Calculates the mapping values for a whole array of analog values
+      at once, e.g. for a recorded trace or for generating a table of
+      all analog values 0 to maxAnalogVal. Each analog value is mapped
+      on its own like the first value of hasChanged(), the hysteresis of
+      setHysteresis() is not applied.
+      Resulting mapping values are in the range 0 to numMapping-1 like
+      getMappedValue() and not centered.
+
+      The function doesn't read any raw values and doesn't change any
+      current or previous values of the object.
+
+      @param  rawValues   array of num analog values from 0 to maxAnalogVal
+      @param  mapValues   array for num resulting mapping values
+      @param  num         number of values to be mapped
+    */
+    void getMappings(const int* rawValues, uint8_t* mapValues, size_t num){
+      for(size_t i = 0 ; i < num ; i++){
+        mapValues[i] = MappedPoti::getMapping(rawValues[i], _centerValLow, _centerValHigh);
+      }
+    }
+
+
+    /*
+      Calculates the mapping table for the mapping parameters and the
+      center of the object (see setMappingTable()). The mapping values
+      of the table are not centered.
+
+      @param    table   array for getMappingTableSize() entries
+      @returns          number of table entries or 0, if no table is possible
+    */
+    uint8_t calcMappingTable(uint16_t* table){
+      return MappedPoti::calcMappingTable(table, _centerValLow, _centerValHigh, _numMapping, _stretch, _maxAnalogVal);
+    }
+
+
+    /*
+      Returns the range of analog values of a mapping value including
+      the center of the object (see MappedPoti). The mapping value is
+      not centered.
+
+      @param    mapValue  mapping value from 0 to getNumMappingValues()-1
+      @param    low       lowest analog value of the mapping value
+      @param    high      highest analog value of the mapping value,
+                          low-1 for a not reached mapping value
+      @returns            true, if the mapping value is reached by any analog value
+    */
+    bool getRawRangeForMapping(uint8_t mapValue, int& low, int& high){
+      if(mapValue > _numMapping){
+        mapValue = _numMapping;
+      }
+      return getRawRange(mapValue, mapValue + 1, _centerValLow, _centerValHigh, low, high);
+    }
+
+
     /*
       Returns current value in a centered range -y ... 0 ... +z
       with y = minAnalogCenterVal - currentAnalogVal
@@ -290,6 +380,70 @@ class CenteredPoti : public MappedPoti {
       return ((int)_prevMapValue) - (_numMapping>>1);
 
     }
+
+
+    /*
+      Sets the unit table for converting the mapping values to units of
+      the application, e.g. 0.1 dB, percent or Q15 coefficients. The
+      table is not copied and must exist as long as it is set.
+
+      @param  table   table in flash memory (PROGMEM) with numMapping values,
+                      the first value for the centered mapping value -x
+                      and the last value for +x, or NULL for no table
+    */
+    void setUnitTable(const int16_t* table){
+      _unitTable = table;
+    }
+
+
+    /*
+      Returns the value of the unit table for any mapping value, e.g. for
+      the mirrored mapping value of a balance. The mapping value is not
+      centered.
+
+      @param    mapValue  mapping value from 0 to getNumMappingValues()-1
+      @param    value     value of the unit table, unchanged if not defined
+      @returns            true, if a unit table is set and the mapping value is valid
+    */
+    bool getUnitValueForMapping(uint8_t mapValue, int16_t& value){
+      if(mapValue >= _numMapping || _unitTable == NULL){
+        return false;
+      }
+      value = (int16_t)pgm_read_word(&_unitTable[mapValue]);
+      return true;
+    }
+
+
+    /*
+      Returns the value of the unit table for the current mapping value.
+
+      The value is looked up in the unit table on each call, based on
+      the current mapping value of the last call of hasChanged() that
+      returned true.
+
+      @param    value   value of the unit table, unchanged if not defined
+      @returns          true, if the value is defined,
+                        false before first call of hasChanged() or without table
+    */
+    bool getCenteredUnitValue(int16_t& value){
+      return getUnitValueForMapping(_curMapValue, value);
+    }
+
+
+    /*
+      Returns the value of the unit table for the previous mapping value.
+
+      The value is looked up in the unit table on each call, based on
+      the previous mapping value of the last call of hasChanged() that
+      returned true.
+
+      @param    value   value of the unit table, unchanged if not defined
+      @returns          true, if the value is defined, false before
+                        hasChanged() has returned true two times or without table
+    */
+    bool getCenteredUnitPrevValue(int16_t& value){
+      return getUnitValueForMapping(_prevMapValue, value);
+    }
 };
 
 #endif
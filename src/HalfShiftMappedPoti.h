@@ -61,7 +61,7 @@
   Advantages:
   - no active waits
   - high performance
-  - memory usage per HalfShiftMappedPoti instance (23 Byte)
+  - memory usage per HalfShiftMappedPoti instance (28 Byte with AVR)
   - handling current and previous value
   - value caching enables stable value analysis
   - easy handling in loops with little code
@@ -72,6 +72,7 @@
   - stabilization by mapping analog values
   - compensation for unequal distribution of analog values (optional)
   - transformation of linear analog and mapping values with very high tolerance
+  - hysteresis at the mapping boundaries (optional)
 */
 
 
@@ -156,7 +157,14 @@ class HalfShiftMappedPoti : public MappedPoti {
 
       mapValue = getMapping(rawValue, 0, 0);
       mapValue = (mapValue + 1) / 2;
-      
+
+      // boundary not crossed by more than the hysteresis?
+      if(isHysteresisRelevant(mapValue)){
+        if((getMapping(getHysteresisValue(rawValue, mapValue), 0, 0) + 1) / 2 == _curMapValue){
+          return false;
+        }
+      }
+
       // Mapping-Wechsel?
       if(mapValue != _curMapValue){
         _prevValue = _curValue;
@@ -169,6 +177,27 @@ class HalfShiftMappedPoti : public MappedPoti {
     }
 
 
+    /*
+      Calculates the mapping values for a whole array of analog values
+      at once, e.g. for a recorded trace or for generating a table of
+      all analog values 0 to maxAnalogVal. Each analog value is mapped
+      on its own like the first value of hasChanged(), the hysteresis of
+      setHysteresis() is not applied.
+
+      The function doesn't read any raw values and doesn't change any
+      current or previous values of the object.
+
+      @param  rawValues   array of num analog values from 0 to maxAnalogVal
+      @param  mapValues   array for num resulting mapping values
+      @param  num         number of values to be mapped
+    */
+    void getMappings(const int* rawValues, uint8_t* mapValues, size_t num){
+      for(size_t i = 0 ; i < num ; i++){
+        mapValues[i] = (getMapping(rawValues[i], 0, 0) + 1) / 2;
+      }
+    }
+
+
     /*
       Returns the number of defined mapping values.
 
@@ -177,6 +206,25 @@ class HalfShiftMappedPoti : public MappedPoti {
     uint8_t getNumMappingValues(){
       return (_numMapping + 2) / 2;
     }
+
+
+    /*
+      Returns the range of analog values of a mapping value. The mapping
+      value k includes the internal mapping values 2k-1 and 2k (see
+      MappedPoti).
+
+      @param    mapValue  mapping value from 0 to getNumMappingValues()-1
+      @param    low       lowest analog value of the mapping value
+      @param    high      highest analog value of the mapping value,
+                          low-1 for a not reached mapping value
+      @returns            true, if the mapping value is reached by any analog value
+    */
+    bool getRawRangeForMapping(uint8_t mapValue, int& low, int& high){
+      if(mapValue > getNumMappingValues()){
+        mapValue = getNumMappingValues();
+      }
+      return getRawRange(mapValue == 0 ? 0 : mapValue * 2 - 1, mapValue * 2 + 1, 0, 0, low, high);
+    }
 };
 
 #endif
@@ -0,0 +1,294 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#ifndef HISTORY_POTI
+#define HISTORY_POTI
+
+#include "MappedPoti.h"
+
+/*
+  Template class for adding a history of the last N changes to a Poti
+  class (given by template parameter P), e.g. HistoryPoti<MappedPoti, 8>
+  or HistoryPoti<StablePoti, 16>. All parameters of the constructor are
+  the same as for the constructor of P.
+
+  With each change reported by hasChanged(), the timestamp (POTI_MILLIS())
+  of the measurement, that caused the change, the analog value and the
+  mapping value are stored in a ring buffer with N entries (1 to 255).
+  When the buffer is full, the oldest entry is overwritten. The mapping
+  values are POTI_MAPPING_UNDEFINED for classes without mapping.
+
+  The entries are accessed by an index, where index 0 is the last change
+  (current value), index 1 the change before (previous value) and so on.
+  Each access needs constant time. Minimum, maximum and average of the
+  last num entries are calculated on request. The number of entries of
+  a time window is returned by getHistoryNum(), so that minimum, maximum
+  and average can be calculated for a time window as well.
+
+  The additional memory usage per instance is N * 8 + 2 Byte with AVR.
+  No dynamic memory is used.
+
+  Example for a MappedPoti with the history of the last 8 changes:
+
+  HistoryPoti<MappedPoti, 8> pot = HistoryPoti<MappedPoti, 8>(A7, 10, 4, 0, 10, 0);
+*/
+template<class P, uint8_t N>
+class HistoryPoti : public P {
+
+  static_assert(N > 0, "HistoryPoti needs at least 1 entry");
+
+  protected:
+
+    // timestamps of the measurements of the stored changes
+    unsigned long _historyMillis[N];
+    // analog values of the stored changes
+    int _historyValues[N];
+    // mapping values of the stored changes
+    uint16_t _historyMappedValues[N];
+    // position of the next entry in the ring buffer
+    uint8_t _historyNext;
+    // number of stored entries
+    uint8_t _historyNum;
+
+    /*
+      Returns the position in the ring buffer of an entry.
+
+      @param    index   0 for the last change up to getHistoryNum()-1
+      @returns          position in the ring buffer
+    */
+    uint8_t getHistoryPos(uint8_t index){
+      return (_historyNext >= index + 1 ? _historyNext - index - 1 : _historyNext + N - index - 1);
+    }
+
+
+    /*
+      Calculates minimum, maximum or sum of the analog or mapping values
+      of the last entries.
+
+      @param    num       number of the last entries, limited to getHistoryNum()
+      @param    mapped    true for the mapping values, false for the analog values
+      @param    op        0 for minimum, 1 for maximum, 2 for sum
+      @returns            the result or POTI_VALUE_UNDEFINED without entries
+    */
+    long getHistoryAggregate(uint8_t num, bool mapped, uint8_t op){
+      long result = 0;
+      long value;
+      uint8_t pos;
+
+      if(num > _historyNum){
+        num = _historyNum;
+      }
+
+      if(num == 0){
+        return POTI_VALUE_UNDEFINED;
+      }
+
+      for(uint8_t i = 0 ; i < num ; i++){
+        pos = getHistoryPos(i);
+        value = (mapped ? (long)_historyMappedValues[pos] : (long)_historyValues[pos]);
+        if(op == 2){
+          result += value;
+        }
+        else if(i == 0 || (op == 0 ? value < result : value > result)){
+          result = value;
+        }
+      }
+      return result;
+    }
+
+
+  public:
+
+    /*
+      Create a new Poti object of class P with a history of the changes.
+
+      @param  args      All parameters of the constructor of class P.
+    */
+    template<typename... Args>
+    HistoryPoti(Args... args) : P(args...){
+      _historyNext = 0;
+      _historyNum = 0;
+    }
+
+
+    /*
+      Returns the information, if value has changed between this and the
+      previous call like hasChanged() of class P. Additionally the change
+      is stored in the history.
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  true, if current value has changed or when called
+                first time
+    */
+    bool hasChanged(){
+      if(P::hasChanged()){
+        _historyMillis[_historyNext] = this->_lastReadMillis;
+        _historyValues[_historyNext] = this->getValue();
+        _historyMappedValues[_historyNext] = getPotiMapping(*this, false);
+        _historyNext = (_historyNext + 1 < N ? _historyNext + 1 : 0);
+        if(_historyNum < N){
+          _historyNum++;
+        }
+        return true;
+      }
+      return false;
+    }
+
+
+    /*
+      Returns the number of stored changes.
+
+      @returns  number of entries from 0 to N
+    */
+    uint8_t getHistoryNum(){
+      return _historyNum;
+    }
+
+
+    /*
+      Returns the number of stored changes, that have been measured within
+      the last windowMillis milliseconds, e.g. as parameter num of
+      getHistoryMin(), getHistoryMax() and getHistoryAverage().
+
+      @param    windowMillis    length of the time window in milliseconds
+      @returns                  number of entries from 0 to N
+    */
+    uint8_t getHistoryNum(unsigned long windowMillis){
+      unsigned long current = POTI_MILLIS();
+      uint8_t num = 0;
+
+      while(num < _historyNum && current - _historyMillis[getHistoryPos(num)] <= windowMillis){
+        num++;
+      }
+      return num;
+    }
+
+
+    /*
+      Returns the timestamp of the measurement of a stored change.
+
+      @param    index   0 for the last change up to getHistoryNum()-1
+      @returns          timestamp in milliseconds (POTI_MILLIS()) or 0 for
+                        not stored entries
+    */
+    unsigned long getHistoryMillis(uint8_t index){
+      if(index >= _historyNum){
+        return 0;
+      }
+      return _historyMillis[getHistoryPos(index)];
+    }
+
+
+    /*
+      Returns the analog value of a stored change.
+
+      @param    index   0 for the last change up to getHistoryNum()-1
+      @returns          analog value or POTI_VALUE_UNDEFINED for not
+                        stored entries
+    */
+    int getHistoryValue(uint8_t index){
+      if(index >= _historyNum){
+        return POTI_VALUE_UNDEFINED;
+      }
+      return _historyValues[getHistoryPos(index)];
+    }
+
+
+    /*
+      Returns the mapping value of a stored change.
+
+      @param    index   0 for the last change up to getHistoryNum()-1
+      @returns          mapping value or POTI_MAPPING_UNDEFINED for not
+                        stored entries and classes without mapping
+    */
+    uint16_t getHistoryMappedValue(uint8_t index){
+      if(index >= _historyNum){
+        return POTI_MAPPING_UNDEFINED;
+      }
+      return _historyMappedValues[getHistoryPos(index)];
+    }
+
+
+    /*
+      Returns the minimum of the analog or mapping values of the last
+      num changes.
+
+      @param    num       number of the last changes, limited to getHistoryNum()
+      @param    mapped    true for the mapping values, false for the analog values
+      @returns            the minimum or POTI_VALUE_UNDEFINED without entries
+    */
+    int getHistoryMin(uint8_t num, bool mapped){
+      return getHistoryAggregate(num, mapped, 0);
+    }
+
+
+    /*
+      Returns the maximum of the analog or mapping values of the last
+      num changes.
+
+      @param    num       number of the last changes, limited to getHistoryNum()
+      @param    mapped    true for the mapping values, false for the analog values
+      @returns            the maximum or POTI_VALUE_UNDEFINED without entries
+    */
+    int getHistoryMax(uint8_t num, bool mapped){
+      return getHistoryAggregate(num, mapped, 1);
+    }
+
+
+    /*
+      Returns the rounded average of the analog or mapping values of the
+      last num changes.
+
+      @param    num       number of the last changes, limited to getHistoryNum()
+      @param    mapped    true for the mapping values, false for the analog values
+      @returns            the average or POTI_VALUE_UNDEFINED without entries
+    */
+    int getHistoryAverage(uint8_t num, bool mapped){
+      long sum = getHistoryAggregate(num, mapped, 2);
+
+      if(num > _historyNum){
+        num = _historyNum;
+      }
+
+      if(num == 0){
+        return POTI_VALUE_UNDEFINED;
+      }
+      return (sum + (num >> 1)) / num;
+    }
+
+
+    /*
+      Reset all internal values, so that the behavior is like directly after the
+      instantiation and before first call of hasChanged(). The history is cleared.
+    */
+    void reset(){
+      P::reset();
+      _historyNext = 0;
+      _historyNum = 0;
+    }
+};
+
+#endif
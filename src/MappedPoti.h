@@ -38,7 +38,8 @@
   values based on potentiometers.
 
   When mapping is used, linear potentiometer shall be used. Logarithmical
-  potentiometers are not suitable.
+  potentiometers are not suitable. For them the TaperedPoti class can be
+  used, which corrects the analog values by a taper table before mapping.
 
   Every returned value of getRawValue() is in relation to a position of
   a specific potentiometer. In this implementation it is always assumed,
@@ -95,11 +96,27 @@
   Arduino microcontroller. If the maximum number is different to the default,
   then the function setMaxAnalogValue() must be called before first use
   of function hasChanged() to set the real maximum number (e.g. 4095).
+
+  Instead of calculating each mapping value with floating point functions,
+  the mapping can be done with a mapping table in flash memory (PROGMEM),
+  that contains the lowest analog value of each mapping value. The table
+  is set by setMappingTable() and can be shared by all objects with the
+  same mapping parameters. Tables can be calculated by calcMappingTable()
+  and copied into the sketch, e.g. as generated by the example MappingTables.
+
+  const uint16_t MAP_10[] PROGMEM = {103, 205, 308, 410, 512, 614, 716, 819, 921};
+  pot.setMappingTable(MAP_10);
+
+  The other way round getRawRangeForMapping() returns the lowest and highest
+  analog value of a mapping value, e.g. for LED rings or motorized faders.
+  It uses the mapping table, if it is set, or solves the mapping formular
+  for the boundaries, so that no search over all analog values is necessary.
   
   Advantages:
   - no active waits
   - high performance
-  - memory usage per MappedPoti instance (23 Byte)
+  - memory usage per MappedPoti instance (28 Byte with AVR) plus floating
+    point functions in flash memory, shared by all instances
   - handling current and previous value
   - value caching enables stable value analysis
   - easy handling in loops with little code
@@ -109,6 +126,8 @@
   - stabilization by weighting previous and current value (optional)
   - stabilization by mapping analog values
   - compensation for unequal distribution of analog values (optional)
+  - hysteresis at the mapping boundaries (optional)
+  - shared mapping tables in flash memory without floating point calculation (optional)
 */
 
 
@@ -124,12 +143,16 @@ class MappedPoti : public StablePoti {
     uint8_t _numMapping;
     // stretching of values to improve linear mapping, defined by parameter scale
     uint8_t _stretch;
+    // number of analog values, that a mapping boundary must be crossed for a change, defined by setHysteresis()
+    uint8_t _hysteresis;
     // maximum value that the analog read function can deliver, often and default is 1023
     int _maxAnalogVal;
+    // mapping table in flash memory or NULL, defined by setMappingTable()
+    const uint16_t* _mappingTable;
 
     /*
       Internal calculation of the mapping value suitable for the given analog
-      value (rawValue).
+      value (rawValue) with the mapping parameters of the object.
       If centered potentiometer is given, the center can be defined by lowest
       and highest analog value of the center mapping. If no values are externally
       given for a centered potientiometer but an uneven numMapping is defined,
@@ -141,6 +164,174 @@ class MappedPoti : public StablePoti {
       @returns                    mapped value suitable for the rawValue
     */
     uint8_t getMapping(int rawValue, int centerValLow, int centerValHigh){
+      if(_mappingTable != NULL){
+        return getTableMapping(rawValue);
+      }
+      return calcMapping(rawValue, centerValLow, centerValHigh, _numMapping, _stretch, _maxAnalogVal);
+    }
+
+
+    /*
+      Internal search of the mapping value suitable for the given analog
+      value (rawValue) in the mapping table by binary search.
+
+      @param      rawValue        the analog input value that has to be mapped
+      @returns                    mapped value suitable for the rawValue
+    */
+    uint8_t getTableMapping(int rawValue){
+      uint8_t low = 0;
+      uint8_t high = _numMapping - 1;
+      uint8_t mid;
+
+      // highest mapping value with a lowest analog value not above rawValue
+      while(low < high){
+        mid = (low + high + 1) >> 1;
+        if(rawValue >= (int)pgm_read_word(&_mappingTable[mid - 1])){
+          low = mid;
+        }
+        else{
+          high = mid - 1;
+        }
+      }
+      return low;
+    }
+
+
+    /*
+      Returns the lowest analog value with a mapping value of at least
+      mapValue from the mapping table or by calcMappingBoundary().
+
+      @param      mapValue        mapping value from 0 to numMapping
+      @param      centerValLow    lowest analog value of the center mapping or 0
+      @param      centerValHigh   highest analog value of the center mapping or 0
+      @returns                    lowest analog value from 0 to maxAnalogVal+1
+    */
+    int getMappingBoundary(uint8_t mapValue, int centerValLow, int centerValHigh){
+      if(_mappingTable != NULL){
+        if(mapValue == 0){
+          return 0;
+        }
+        if(mapValue >= _numMapping){
+          return _maxAnalogVal + 1;
+        }
+        return pgm_read_word(&_mappingTable[mapValue - 1]);
+      }
+      return calcMappingBoundary(mapValue, centerValLow, centerValHigh, _numMapping, _stretch, _maxAnalogVal);
+    }
+
+
+    /*
+      Returns the range of analog values from the lowest analog value of
+      mapping value lowMapValue to the last analog value before mapping
+      value highMapValue.
+
+      @param      lowMapValue     first mapping value of the range
+      @param      highMapValue    first mapping value after the range
+      @param      centerValLow    lowest analog value of the center mapping or 0
+      @param      centerValHigh   highest analog value of the center mapping or 0
+      @param      low             lowest analog value of the range
+      @param      high            highest analog value of the range
+      @returns                    false, if the range is empty
+    */
+    bool getRawRange(uint8_t lowMapValue, uint8_t highMapValue, int centerValLow, int centerValHigh,
+      int& low, int& high){
+      low = getMappingBoundary(lowMapValue, centerValLow, centerValHigh);
+      high = getMappingBoundary(highMapValue, centerValLow, centerValHigh) - 1;
+      return low <= high;
+    }
+
+
+    /*
+      Returns the analog value for checking the hysteresis of a mapping
+      change. The analog value is moved by the hysteresis back in the
+      direction of the current mapping value. If the moved value still
+      leads to a different mapping value than the current one, then the
+      mapping boundary was crossed by more than the hysteresis.
+
+      @param      rawValue        the analog value of the new mapping value
+      @param      mapValue        the new mapping value
+      @returns                    moved analog value from 0 to maxAnalogVal
+    */
+    int getHysteresisValue(int rawValue, uint8_t mapValue){
+      return calcHysteresisValue(rawValue, mapValue, _curMapValue, _hysteresis, _maxAnalogVal);
+    }
+
+
+    /*
+      Returns the information, if a mapping change has to be checked
+      against the hysteresis.
+
+      @param      mapValue        the new mapping value
+      @returns                    true, if the hysteresis is relevant
+    */
+    bool isHysteresisRelevant(uint8_t mapValue){
+      return isHysteresisRelevant(mapValue, _curMapValue, _hysteresis);
+    }
+
+
+  public:
+
+    /*
+      Returns the information, if a mapping change has to be checked
+      against the hysteresis. The function is used by all mapping classes
+      with setHysteresis().
+
+      @param      mapValue        the new mapping value
+      @param      curMapValue     the current mapping value
+      @param      hysteresis      hysteresis in analog values
+      @returns                    true, if the hysteresis is relevant
+    */
+    static bool isHysteresisRelevant(uint8_t mapValue, uint8_t curMapValue, uint8_t hysteresis){
+      return hysteresis > 0 && mapValue != curMapValue
+        && curMapValue != POTI_MAPPING_UNDEFINED;
+    }
+
+
+    /*
+      Returns the analog value for checking the hysteresis of a mapping
+      change. The analog value is moved by the hysteresis back in the
+      direction of the current mapping value. The function is used by all
+      mapping classes with setHysteresis().
+
+      @param      rawValue        the analog value of the new mapping value
+      @param      mapValue        the new mapping value
+      @param      curMapValue     the current mapping value
+      @param      hysteresis      hysteresis in analog values
+      @param      maxAnalogVal    maximum analog value
+      @returns                    moved analog value from 0 to maxAnalogVal
+    */
+    static int calcHysteresisValue(int rawValue, uint8_t mapValue, uint8_t curMapValue,
+      uint8_t hysteresis, int maxAnalogVal){
+      if(mapValue > curMapValue){
+        rawValue -= hysteresis;
+        return (rawValue < 0 ? 0 : rawValue);
+      }
+      rawValue += hysteresis;
+      return (rawValue > maxAnalogVal ? maxAnalogVal : rawValue);
+    }
+
+
+    /*
+      Calculation of the mapping value suitable for the given analog value
+      (rawValue) with the given mapping parameters. The function is used by
+      all mapping classes and can be used without an object, e.g. for
+      calculating tables. The parameters must be in the ranges, that the
+      constructors of the mapping classes ensure.
+      If centered potentiometer is given, the center can be defined by lowest
+      and highest analog value of the center mapping. If no values are externally
+      given for a centered potientiometer but an uneven numMapping is defined,
+      then internally a center is defined automatically.
+
+      @param      rawValue        the analog input value that has to be mapped
+      @param      centerValLow    lowest analog value of the center mapping or 0
+      @param      centerValHigh   highest analog value of the center mapping or 0
+      @param      numMapping      number of mapping values from 2 to 198
+      @param      stretch         stretching from 0 (linear) to 20
+      @param      maxAnalogVal    maximum analog value, uneven number
+      @returns                    mapped value suitable for the rawValue
+    */
+    static uint8_t calcMapping(int rawValue, int centerValLow, int centerValHigh,
+      uint8_t numMapping, uint8_t stretch, int maxAnalogVal){
       /*
         For calculating the mapping including the stretching, the analog
         values need to be separated into left and right side for processing.
@@ -183,32 +374,32 @@ class MappedPoti : public StablePoti {
 
       // also centered, if uneven mapping number,
       // but no overwriting of externally given center values
-      if(!centered && (_numMapping & 0x01) > 0){
+      if(!centered && (numMapping & 0x01) > 0){
         centered = true;
-        i = ((_maxAnalogVal + 1) / _numMapping)>>1;
-        centerValLow = (_maxAnalogVal>>1) - i;
-        centerValHigh = (_maxAnalogVal>>1) + i;
+        i = ((maxAnalogVal + 1) / numMapping)>>1;
+        centerValLow = (maxAnalogVal>>1) - i;
+        centerValHigh = (maxAnalogVal>>1) + i;
       }
 
       // if center values available then special treatment of center position upfront
       if(centered && rawValue >= centerValLow && rawValue <= centerValHigh){
-        return (_numMapping>>1); // uneven mapping number, middle value
+        return (numMapping>>1); // uneven mapping number, middle value
       }
 
-      leftSide = (centered && rawValue < centerValLow) || (!centered && rawValue < ((_maxAnalogVal + 1)>>1));
+      leftSide = (centered && rawValue < centerValLow) || (!centered && rawValue < ((maxAnalogVal + 1)>>1));
 
       if(leftSide){
         // left side
-        valTot = (!centered ? (_maxAnalogVal + 1)>>1 : centerValLow);
-        mapTot = (!centered ? _numMapping>>1 : (_numMapping - 1)>>1);
+        valTot = (!centered ? (maxAnalogVal + 1)>>1 : centerValLow);
+        mapTot = (!centered ? numMapping>>1 : (numMapping - 1)>>1);
       }
       else{
         // right side
-        valTot = (!centered ? (_maxAnalogVal + 1)>>1 : _maxAnalogVal - centerValHigh);
-        mapTot = (!centered ? _numMapping>>1 : (_numMapping - 1)>>1);
+        valTot = (!centered ? (maxAnalogVal + 1)>>1 : maxAnalogVal - centerValHigh);
+        mapTot = (!centered ? numMapping>>1 : (numMapping - 1)>>1);
       }
       stdDiv = valTot / mapTot;
-      scale = 1.0 + _stretch / 10.0;
+      scale = 1.0 + stretch / 10.0;
 
       if(leftSide){
         // left side
@@ -217,25 +408,162 @@ class MappedPoti : public StablePoti {
       }
       else{
         // right side
-        tmpFloat = (_numMapping - 1) - trunc((_maxAnalogVal - rawValue) / (stdDiv / scale
-                      * ((scale - 1.0 / scale) * (_maxAnalogVal - rawValue) / valTot + 1.0 / scale)));
+        tmpFloat = (numMapping - 1) - trunc((maxAnalogVal - rawValue) / (stdDiv / scale
+                      * ((scale - 1.0 / scale) * (maxAnalogVal - rawValue) / valTot + 1.0 / scale)));
       }
 
       mapValue = uint8_t(tmpFloat);
 
       // potential correction of calculation errors
-      if(mapValue > _numMapping){
+      if(mapValue > numMapping){
         mapValue = 0;
       }
-      else if(mapValue == _numMapping){
-        mapValue = _numMapping - 1;
+      else if(mapValue == numMapping){
+        mapValue = numMapping - 1;
       }
 
       return mapValue;
     }
 
 
-  public:
+    /*
+      Calculation of a mapping table for the given mapping parameters with
+      calcMapping() for all analog values. Entry k-1 of the table is the lowest
+      analog value of mapping value k (for k from 1 to numMapping-1). Mapping
+      values, that are not reached, get the boundary of the next reached
+      mapping value or maxAnalogVal+1. The table has numMapping-1 entries.
+
+      @param      table           array for numMapping-1 entries
+      @param      centerValLow    lowest analog value of the center mapping or 0
+      @param      centerValHigh   highest analog value of the center mapping or 0
+      @param      numMapping      number of mapping values from 2 to 198
+      @param      stretch         stretching from 0 (linear) to 20
+      @param      maxAnalogVal    maximum analog value, uneven number
+      @returns                    number of table entries or 0, if the mapping
+                                  values are not ascending with the analog values
+    */
+    static uint8_t calcMappingTable(uint16_t* table, int centerValLow, int centerValHigh,
+      uint8_t numMapping, uint8_t stretch, int maxAnalogVal){
+      uint8_t mapValue;
+      uint8_t prevMapValue = 0;
+
+      for(int i = 0 ; i <= maxAnalogVal ; i++){
+        mapValue = calcMapping(i, centerValLow, centerValHigh, numMapping, stretch, maxAnalogVal);
+        if(mapValue < prevMapValue){
+          return 0;
+        }
+        while(prevMapValue < mapValue){
+          table[prevMapValue++] = i;
+        }
+      }
+
+      while(prevMapValue < numMapping - 1){
+        table[prevMapValue++] = maxAnalogVal + 1;
+      }
+      return numMapping - 1;
+    }
+
+
+    /*
+      Calculation of the lowest analog value with a mapping value of at least
+      mapValue for the given mapping parameters, which is the same as entry
+      mapValue-1 of calcMappingTable(). The mapping formular of calcMapping()
+      is solved for the analog value and rounding differences are corrected
+      with calcMapping(), so that only few calculations are necessary
+      independent of maxAnalogVal.
+
+      @param      mapValue        mapping value from 0 to numMapping
+      @param      centerValLow    lowest analog value of the center mapping or 0
+      @param      centerValHigh   highest analog value of the center mapping or 0
+      @param      numMapping      number of mapping values from 2 to 198
+      @param      stretch         stretching from 0 (linear) to 20
+      @param      maxAnalogVal    maximum analog value, uneven number
+      @returns                    lowest analog value from 0 to maxAnalogVal
+                                  or maxAnalogVal+1 for numMapping
+    */
+    static int calcMappingBoundary(uint8_t mapValue, int centerValLow, int centerValHigh,
+      uint8_t numMapping, uint8_t stretch, int maxAnalogVal){
+      /*
+        With the mapping divider {} = a * ValCur + b the formular for the
+        left side of calcMapping() is MapCur = trunc(ValCur / (a * ValCur + b)).
+        Mapping value m is reached from ValCur = m * b / (1 - m * a) on.
+        The right side is the same with (ValHigh - ValCur) and (2 * MapTot - m).
+      */
+
+      float scale, stdDiv, valTot, mapTot, a, b, m, x;
+      int rawValue, startVal, endVal;
+      int i;
+      bool centered = (centerValLow > 0);
+
+      if(mapValue == 0){
+        return 0;
+      }
+
+      if(mapValue >= numMapping){
+        return maxAnalogVal + 1;
+      }
+
+      // same center like in calcMapping()
+      if(!centered && (numMapping & 0x01) > 0){
+        centered = true;
+        i = ((maxAnalogVal + 1) / numMapping)>>1;
+        centerValLow = (maxAnalogVal>>1) - i;
+        centerValHigh = (maxAnalogVal>>1) + i;
+      }
+
+      if(centered && mapValue == (numMapping>>1)){
+        // the left side ends before the center
+        rawValue = centerValLow;
+      }
+      else{
+        if(mapValue < (numMapping>>1)){
+          // left side
+          startVal = 0;
+          endVal = (!centered ? (maxAnalogVal + 1)>>1 : centerValLow);
+          valTot = endVal;
+          m = mapValue;
+        }
+        else{
+          // right side
+          startVal = (!centered ? (maxAnalogVal + 1)>>1 : centerValHigh + 1);
+          endVal = maxAnalogVal + 1;
+          valTot = (!centered ? (maxAnalogVal + 1)>>1 : maxAnalogVal - centerValHigh);
+          m = numMapping - mapValue;
+        }
+        mapTot = (!centered ? numMapping>>1 : (numMapping - 1)>>1);
+        stdDiv = valTot / mapTot;
+        scale = 1.0 + stretch / 10.0;
+        a = stdDiv / scale * (scale - 1.0 / scale) / valTot;
+        b = stdDiv / scale / scale;
+        x = (1.0 - m * a > 0.0 ? m * b / (1.0 - m * a) : maxAnalogVal + 2);
+
+        if(mapValue < (numMapping>>1)){
+          rawValue = (x > endVal ? endVal : (int)ceil(x));
+        }
+        else{
+          rawValue = (x > maxAnalogVal + 1 ? startVal : maxAnalogVal + 1 - (int)ceil(x));
+        }
+
+        if(rawValue < startVal){
+          rawValue = startVal;
+        }
+        else if(rawValue > endVal){
+          rawValue = endVal;
+        }
+      }
+
+      // correction of rounding differences to calcMapping()
+      while(rawValue > 0
+        && calcMapping(rawValue - 1, centerValLow, centerValHigh, numMapping, stretch, maxAnalogVal) >= mapValue){
+        rawValue--;
+      }
+      while(rawValue <= maxAnalogVal
+        && calcMapping(rawValue, centerValLow, centerValHigh, numMapping, stretch, maxAnalogVal) < mapValue){
+        rawValue++;
+      }
+      return rawValue;
+    }
+
 
     /*
       Create a new MappedPoti object to handle the input of an analog input pin
@@ -276,7 +604,9 @@ class MappedPoti : public StablePoti {
       _prevMapValue = POTI_MAPPING_UNDEFINED;
       _numMapping = numMapping;
       _stretch = stretch;
+      _hysteresis = 0;
       _maxAnalogVal = 1023;
+      _mappingTable = NULL;
 
       if(_numMapping > 100){
         _numMapping = 100;
@@ -343,6 +673,82 @@ class MappedPoti : public StablePoti {
     }
 
 
+    /*
+      Defines a hysteresis band around each mapping boundary. The mapping
+      value changes only, when the analog value has crossed the boundary
+      by at least the given number of analog values. This prevents the
+      flickering of the mapping value at a boundary without stronger
+      stabilization. The first mapping value is always set directly.
+
+      @param  hysteresis  Number of analog values from 0 to 255.
+                          Value 0 (default) means no hysteresis. Should be
+                          less than half of the analog values per mapping value.
+    */
+    void setHysteresis(uint8_t hysteresis){
+      _hysteresis = hysteresis;
+    }
+
+
+    /*
+      Sets a mapping table in flash memory (PROGMEM), that replaces the
+      calculation of the mapping values. The table must be calculated for
+      exactly the mapping parameters of the object (see calcMappingTable()).
+      Objects with the same mapping parameters can share one table, so that
+      the mapping needs no floating point calculation and no additional RAM
+      except the pointer.
+
+      @param  table   table in flash memory with getMappingTableSize() entries
+                      or NULL for the calculation of the mapping values
+    */
+    void setMappingTable(const uint16_t* table){
+      _mappingTable = table;
+    }
+
+
+    /*
+      Returns the number of entries of a mapping table for the object.
+
+      @returns  number of table entries
+    */
+    uint8_t getMappingTableSize(){
+      return _numMapping - 1;
+    }
+
+
+    /*
+      Calculates the mapping table for the mapping parameters of the object.
+      The mapping values of the table are the same as calculated by
+      hasChanged() without table.
+
+      @param    table   array for getMappingTableSize() entries
+      @returns          number of table entries or 0, if no table is possible
+    */
+    uint8_t calcMappingTable(uint16_t* table){
+      return calcMappingTable(table, 0, 0, _numMapping, _stretch, _maxAnalogVal);
+    }
+
+
+    /*
+      Returns the range of analog values of a mapping value, e.g. for
+      the feedback of LED rings or for the target of motorized faders.
+      The range is taken from the mapping table, if it is set, or is
+      calculated with only few calculations (see calcMappingBoundary()).
+      The hysteresis is not included.
+
+      @param    mapValue  mapping value from 0 to getNumMappingValues()-1
+      @param    low       lowest analog value of the mapping value
+      @param    high      highest analog value of the mapping value,
+                          low-1 for a not reached mapping value
+      @returns            true, if the mapping value is reached by any analog value
+    */
+    bool getRawRangeForMapping(uint8_t mapValue, int& low, int& high){
+      if(mapValue > _numMapping){
+        mapValue = _numMapping;
+      }
+      return getRawRange(mapValue, mapValue + 1, 0, 0, low, high);
+    }
+
+
     /*
       Returns the information, if mapping value has changed between this
       and the previous call.
@@ -369,7 +775,14 @@ class MappedPoti : public StablePoti {
       }
 
       mapValue = getMapping(rawValue, 0, 0);
-      
+
+      // boundary not crossed by more than the hysteresis?
+      if(isHysteresisRelevant(mapValue)){
+        if(getMapping(getHysteresisValue(rawValue, mapValue), 0, 0) == _curMapValue){
+          return false;
+        }
+      }
+
       // Mapping-Wechsel?
       if(mapValue != _curMapValue){
         _prevValue = _curValue;
@@ -382,6 +795,29 @@ class MappedPoti : public StablePoti {
     }
 
 
+    /*
+      Calculates the mapping values for a whole array of analog values
+      at once, e.g. for a recorded trace or for generating a table of
+      all analog values 0 to maxAnalogVal. Each analog value is mapped
+      on its own like the first value of hasChanged(). The hysteresis of
+      setHysteresis() is not applied, because it depends on the preceding
+      values, so hasChanged() can keep the previous mapping value near the
+      mapping boundaries.
+
+      The function doesn't read any raw values and doesn't change any
+      current or previous values of the object.
+
+      @param  rawValues   array of num analog values from 0 to maxAnalogVal
+      @param  mapValues   array for num resulting mapping values
+      @param  num         number of values to be mapped
+    */
+    void getMappings(const int* rawValues, uint8_t* mapValues, size_t num){
+      for(size_t i = 0 ; i < num ; i++){
+        mapValues[i] = getMapping(rawValues[i], 0, 0);
+      }
+    }
+
+
     /*
       Returns current mapping value suitable to the analog value
       given by getValue(). The value was calculated and set by the
@@ -421,4 +857,24 @@ class MappedPoti : public StablePoti {
     }
 };
 
+
+/*
+  Returns the current or previous mapping value of an object of any Poti
+  class, e.g. in templates and collections of different Poti classes. The
+  most specific overload is used, so classes without mapping get
+  POTI_MAPPING_UNDEFINED. The overload for WideMappedPoti is defined in
+  WideMappedPoti.h.
+
+  @param    poti    the object
+  @param    prev    true for the previous mapping value
+  @returns          mapping value or POTI_MAPPING_UNDEFINED
+*/
+inline uint16_t getPotiMapping(Poti& /*poti*/, bool /*prev*/){
+  return POTI_MAPPING_UNDEFINED;
+}
+
+inline uint16_t getPotiMapping(MappedPoti& poti, bool prev){
+  return (prev ? poti.getMappedPrevValue() : poti.getMappedValue());
+}
+
 #endif
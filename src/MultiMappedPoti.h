@@ -0,0 +1,532 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#ifndef MULTI_MAPPED_POTI
+#define MULTI_MAPPED_POTI
+
+#include "MappedPoti.h"
+
+#define MULTI_MAPPED_POTI_LINEAR      0
+#define MULTI_MAPPED_POTI_CENTERED    1
+#define MULTI_MAPPED_POTI_HALF_SHIFT  2
+
+/*
+  Based on the Poti and StablePoti classes and all its advantages the
+  MultiMappedPoti class maps the analog values of one potentiometer to K
+  independent mapping outputs (given by template parameter K), e.g. a 10
+  step mapping and a 100 step mapping of the same knob.
+
+  The measurement and the stabilization (averaging and weighting) is done
+  only once per step for all outputs. Each output has its own mapping
+  configuration (number of mapping values, stretching, linear, centered
+  or half shift mapping) and delivers exactly the same values as an own
+  MappedPoti, CenteredPoti or HalfShiftMappedPoti object with the same
+  parameters would deliver. Each output has its own change information,
+  current and previous analog value and current and previous mapping value.
+  The inherited getValue() and getPrevValue() deliver the shared analog
+  value, that was relevant for the last change of any output, so that the
+  object can be used like every other Poti (e.g. in PotiCollection,
+  SnapshotPoti or HistoryPoti).
+
+  After instantiation all outputs are linear mappings with 2 mapping values.
+  The outputs are configured by setMapping(), setCenteredMapping() and
+  setHalfShiftMapping() before first call of hasChanged(). When the maximum
+  analog value is not the default 1023, setMaxAnalogValue() must be called
+  before the outputs are configured.
+
+  The function hasChanged() must be called continously, at least once per
+  loop run. It returns true, if at least one output has changed. Then
+  hasChanged(output) tells, which outputs have changed.
+
+  Advantages:
+  - no active waits
+  - one measurement and stabilization for several mappings
+  - memory usage with AVR per output (14 Byte) plus per instance (22 Byte)
+  - identical values as with the single mapping classes
+  - handling current and previous values per output
+  - reduction of raw value reads (optional)
+  - subclasses for own raw read logic possible (optional)
+  - stabilization by calculating average of measurements (optional)
+  - stabilization by weighting previous and current value (optional)
+  - stabilization by mapping analog values
+  - compensation for unequal distribution of analog values (optional)
+  - hysteresis at the mapping boundaries (optional)
+*/
+
+
+template<uint8_t K>
+class MultiMappedPoti : public StablePoti {
+
+  protected:
+
+    // maximum value that the analog read function can deliver, often and default is 1023
+    int _maxAnalogVal;
+    // number of analog values, that a mapping boundary must be crossed for a change, defined by setHysteresis()
+    uint8_t _hysteresis;
+
+    // low border of the center per output, 0 if not centered
+    int _centerValLow[K];
+    // high border of the center per output, 0 if not centered
+    int _centerValHigh[K];
+    // current analog value per output, relevant for the last change of the mapping value
+    int _curValueOut[K];
+    // previous analog value per output
+    int _prevValueOut[K];
+    // kind of mapping per output, MULTI_MAPPED_POTI_LINEAR, _CENTERED or _HALF_SHIFT
+    uint8_t _mode[K];
+    // number of internal mapping values per output (doubled for half shift mapping)
+    uint8_t _numMapping[K];
+    // stretching of values per output
+    uint8_t _stretch[K];
+    // current mapping value per output
+    uint8_t _curMapValue[K];
+    // previous mapping value per output
+    uint8_t _prevMapValue[K];
+    // change information per output of the last call of hasChanged()
+    bool _changed[K];
+
+
+    /*
+      Calculates the mapping value of an output for the given analog value.
+
+      @param    output    output from 0 to K-1
+      @param    rawValue  the analog value that has to be mapped
+      @returns            mapping value of the output
+    */
+    uint8_t getOutputMapping(uint8_t output, int rawValue){
+      uint8_t mapValue = MappedPoti::calcMapping(rawValue, _centerValLow[output],
+        _centerValHigh[output], _numMapping[output], _stretch[output], _maxAnalogVal);
+
+      if(_mode[output] == MULTI_MAPPED_POTI_HALF_SHIFT){
+        mapValue = (mapValue + 1) / 2;
+      }
+      return mapValue;
+    }
+
+
+  public:
+
+    /*
+      Create a new MultiMappedPoti object to handle the input of an analog
+      input pin and map the analog values to K mapping outputs.
+
+      Parameter weightPrev defines weight of previous value. Current value has
+      fixed weight of 4. The higher the value, the more stable and slower
+      will the output value change.
+
+      Parameter addNumRawAvg value x>0 means x+1 measurements are done and
+      calculation is x milliseconds delayed (no active waiting). Each
+      additional measurement adds 1 millisecond delay before final calculation.
+
+      @param  inputPin          Analog pin for reading the analog raw value.
+                                Possible pin configuration must be done before
+                                hasChanged() calls. Values for Arduino e.g. A0 to A7.
+      @param  readCycleMillis   Minimum time in milliseconds that must have been
+                                waited between succeeding calls of getRawValue().
+                                Values from 0 to 255. Value 0 means no waits and
+                                getRawvalue() is called by each hasChanged() call.
+      @param  weightPrev        Weight of the previous value, when the new output
+                                value is calculated as combined value.
+                                Values 0 to 12. Value 0 means no weighting logic.
+      @param  addNumRawAvg      Additional nummer of raw value measurements for
+                                building an average with first measurement.
+                                Values 0 to 7. Value 0 means no average calculation.
+    */
+    MultiMappedPoti(uint8_t inputPin, uint8_t readCycleMillis, uint8_t weightPrev, uint8_t addNumRawAvg) :
+      StablePoti(inputPin, readCycleMillis, weightPrev, addNumRawAvg){
+
+      _maxAnalogVal = 1023;
+      _hysteresis = 0;
+      for(uint8_t i = 0 ; i < K ; i++){
+        setMapping(i, 2, 0);
+      }
+    }
+
+
+    /*
+      Configures an output as linear mapping like MappedPoti.
+
+      @param  output      output from 0 to K-1
+      @param  numMapping  Number of mapping values. Range is from 2 to 100.
+      @param  stretch     Factor for stretching analog values during the
+                          mapping calculation. Values from 0 (no use, linear)
+                          to 20. Value 20 ist highest stretching.
+    */
+    void setMapping(uint8_t output, uint8_t numMapping, uint8_t stretch){
+      if(numMapping > 100){
+        numMapping = 100;
+      }
+
+      if(numMapping < 2){
+        numMapping = 2;
+      }
+
+      if(stretch > 20){
+        stretch = 20;
+      }
+
+      _mode[output] = MULTI_MAPPED_POTI_LINEAR;
+      _numMapping[output] = numMapping;
+      _stretch[output] = stretch;
+      _centerValLow[output] = 0;
+      _centerValHigh[output] = 0;
+      resetOutput(output);
+    }
+
+
+    /*
+      Configures an output as centered mapping like CenteredPoti.
+
+      @param  output      output from 0 to K-1
+      @param  numMapping  Number of mapping values. Must be a uneven number.
+                          Even numbers will be increased by one.
+                          Range is from 3 to 101.
+      @param  stretch     Factor for stretching analog values during the
+                          mapping calculation. Values from 0 (no use, linear)
+                          to 20. Value 20 ist highest stretching.
+      @param  centerTol   Tolerance on left and right side of centerVal.
+                          Center is defined as 2*centerTol + 1 values.
+                          Values from 10 to 255.
+      @param  centerVal   Analog value of the physical center position of the
+                          turning knob. If 0 is given, a standard value is
+                          calculated internally as maxAnalogVal/2.
+    */
+    void setCenteredMapping(uint8_t output, uint8_t numMapping, uint8_t stretch,
+      uint8_t centerTol, int centerVal){
+
+      setMapping(output, numMapping, stretch);
+
+      if(numMapping < 3){
+        numMapping = 3;
+      }
+
+      if(numMapping > 101){
+        numMapping = 101;
+      }
+
+      // uneven number?
+      if((numMapping & 0x01) == 0){
+        numMapping++;
+      }
+
+      if(centerTol < 10){
+        centerTol = 10;
+      }
+
+      if(centerVal == 0){
+        centerVal = _maxAnalogVal>>1;
+      }
+
+      _mode[output] = MULTI_MAPPED_POTI_CENTERED;
+      _numMapping[output] = numMapping;
+      _centerValLow[output] = centerVal - centerTol;
+      _centerValHigh[output] = centerVal + centerTol;
+    }
+
+
+    /*
+      Configures an output as half shift mapping like HalfShiftMappedPoti.
+
+      @param  output      output from 0 to K-1
+      @param  numMapping  Number of mapping values. Range is from 2 to 100.
+      @param  stretch     Factor for stretching analog values during the
+                          mapping calculation. Values from 0 (no use, linear)
+                          to 20. Value 20 ist highest stretching.
+    */
+    void setHalfShiftMapping(uint8_t output, uint8_t numMapping, uint8_t stretch){
+      setMapping(output, numMapping, stretch);
+
+      // switch to different doubled mapping
+      _mode[output] = MULTI_MAPPED_POTI_HALF_SHIFT;
+      _numMapping[output] = (_numMapping[output] - 1) * 2;
+    }
+
+
+    /*
+      Returns the number of mapping outputs.
+
+      @returns  number of outputs K
+    */
+    uint8_t getNumOutputs(){
+      return K;
+    }
+
+
+    /*
+      Returns the number of defined mapping values of an output.
+      This can differ to the originally given parameter "numMapping"
+      due to necessary corrections.
+
+      @param    output    output from 0 to K-1
+      @returns            number of mapping values of the output
+    */
+    uint8_t getNumMappingValues(uint8_t output){
+      if(_mode[output] == MULTI_MAPPED_POTI_HALF_SHIFT){
+        return (_numMapping[output] + 2) / 2;
+      }
+      return _numMapping[output];
+    }
+
+
+    /*
+      Returns the maximum analog value with which the internal
+      mapping calcuation is done.
+
+      @returns  internally set maximum analog value
+    */
+    int getMaxAnalogValue(){
+      return _maxAnalogVal;
+    }
+
+
+    /*
+      Sets and returns the maximum analog value with which the
+      internal mapping calculation shall be done. Will overwrite
+      the default value (1023). The value must be always an uneven
+      number and will, in case of an even one, decreased by 1.
+
+      Must be called before the outputs are configured.
+
+      @param    maxAnalogVal  the maximum analog value for the internal
+                              calculations. Must be an uneven number.
+      @returns                internally set maximum analog value
+    */
+    int setMaxAnalogValue(int maxAnalogVal){
+      if((maxAnalogVal & 0x0001) == 0){
+        _maxAnalogVal = maxAnalogVal - 1;
+      }
+      else{
+        _maxAnalogVal = maxAnalogVal;
+      }
+      return _maxAnalogVal;
+    }
+
+
+    /*
+      Defines a hysteresis band around each mapping boundary of all outputs
+      like setHysteresis() of MappedPoti. The mapping value of an output
+      changes only, when the analog value has crossed the boundary by at
+      least the given number of analog values.
+
+      @param  hysteresis  Number of analog values from 0 to 255.
+                          Value 0 (default) means no hysteresis.
+    */
+    void setHysteresis(uint8_t hysteresis){
+      _hysteresis = hysteresis;
+    }
+
+
+    /*
+      Returns the information, if the mapping value of at least one output
+      has changed between this and the previous call.
+
+      The function must be called continously, at least once per loop run. It
+      will measure raw values, calculate stabilization once and the mappings
+      of all outputs, identify changes and set current and previous values
+      and mappings of the outputs.
+
+      The shared current and previous analog value (getValue() and
+      getPrevValue()) are set, when at least one output has changed.
+
+      @returns  true, if at least one current mapping value has changed
+                or when called first time
+    */
+    bool hasChanged(){
+      int internalPrevVal = _prevValueInternal;
+      int rawValue = getStabilizedRawValue();
+      uint8_t mapValue;
+      bool changed = false;
+
+      for(uint8_t i = 0 ; i < K ; i++){
+        _changed[i] = false;
+      }
+
+      if(rawValue == POTI_VALUE_UNDEFINED){
+        return false;
+      }
+
+      // no change by current measurement?
+      if(rawValue == internalPrevVal){
+        return false;
+      }
+
+      for(uint8_t i = 0 ; i < K ; i++){
+        mapValue = getOutputMapping(i, rawValue);
+
+        // boundary not crossed by more than the hysteresis?
+        if(MappedPoti::isHysteresisRelevant(mapValue, _curMapValue[i], _hysteresis)){
+          if(getOutputMapping(i, MappedPoti::calcHysteresisValue(rawValue, mapValue,
+            _curMapValue[i], _hysteresis, _maxAnalogVal)) == _curMapValue[i]){
+            continue;
+          }
+        }
+
+        if(mapValue != _curMapValue[i]){
+          _prevValueOut[i] = _curValueOut[i];
+          _curValueOut[i] = rawValue;
+          _prevMapValue[i] = _curMapValue[i];
+          _curMapValue[i] = mapValue;
+          _changed[i] = true;
+          changed = true;
+        }
+      }
+
+      if(changed){
+        _prevValue = _curValue;
+        _curValue = rawValue;
+      }
+      return changed;
+    }
+
+
+    /*
+      Returns the information, if the mapping value of the output has
+      changed by the last call of hasChanged().
+
+      @param    output    output from 0 to K-1
+      @returns            true, if current mapping value of the output has changed
+    */
+    bool hasChanged(uint8_t output){
+      return _changed[output];
+    }
+
+
+    /*
+      Returns current analog value of an output, that was relevant for the
+      last change of its mapping value.
+
+      @param    output    output from 0 to K-1
+      @returns            current value from 0 to maxAnalogVal
+                          or POTI_VALUE_UNDEFINED before first change
+    */
+    int getOutputValue(uint8_t output){
+      return _curValueOut[output];
+    }
+
+
+    /*
+      Returns previous analog value of an output. This previous value was
+      the current value before the last change of the output.
+
+      @param    output    output from 0 to K-1
+      @returns            previous value from 0 to maxAnalogVal
+                          or POTI_VALUE_UNDEFINED before the output has
+                          changed two times
+    */
+    int getOutputPrevValue(uint8_t output){
+      return _prevValueOut[output];
+    }
+
+
+    /*
+      Returns current mapping value of an output. Centered outputs return
+      the value in the range 0 to numMapping-1 like getMappedValue() of
+      CenteredPoti.
+
+      @param    output    output from 0 to K-1
+      @returns            current mapping value in range 0 to numMapping-1
+                          or POTI_MAPPING_UNDEFINED before first change
+    */
+    uint8_t getMappedValue(uint8_t output){
+      return _curMapValue[output];
+    }
+
+
+    /*
+      Returns previous mapping value of an output.
+
+      @param    output    output from 0 to K-1
+      @returns            previous mapping value from 0 to numMapping-1
+                          or POTI_MAPPING_UNDEFINED before the output has
+                          changed two times
+    */
+    uint8_t getMappedPrevValue(uint8_t output){
+      return _prevMapValue[output];
+    }
+
+
+    /*
+      Returns current mapping value of a centered output in a centered
+      range -x ... 0 ... +x where x = (numMapping-1)/2.
+
+      @param    output    output from 0 to K-1
+      @returns            current mapping value in the centered range
+                          or POTI_MAPPING_UNDEFINED before first change
+    */
+    int getCenteredMappedValue(uint8_t output){
+      if(_curMapValue[output] == POTI_MAPPING_UNDEFINED){
+        return POTI_MAPPING_UNDEFINED;
+      }
+      return ((int)_curMapValue[output]) - (_numMapping[output]>>1);
+    }
+
+
+    /*
+      Returns previous mapping value of a centered output in a centered
+      range -x ... 0 ... +x where x = (numMapping-1)/2.
+
+      @param    output    output from 0 to K-1
+      @returns            previous mapping value in the centered range
+                          or POTI_MAPPING_UNDEFINED before the output has
+                          changed two times
+    */
+    int getCenteredMappedPrevValue(uint8_t output){
+      if(_prevMapValue[output] == POTI_MAPPING_UNDEFINED){
+        return POTI_MAPPING_UNDEFINED;
+      }
+      return ((int)_prevMapValue[output]) - (_numMapping[output]>>1);
+    }
+
+
+    /*
+      Reset the values of one output, so that the behavior of the output
+      is like directly after the instantiation. The stabilization is not
+      reset.
+
+      @param    output    output from 0 to K-1
+    */
+    void resetOutput(uint8_t output){
+      _curMapValue[output] = POTI_MAPPING_UNDEFINED;
+      _prevMapValue[output] = POTI_MAPPING_UNDEFINED;
+      _curValueOut[output] = POTI_VALUE_UNDEFINED;
+      _prevValueOut[output] = POTI_VALUE_UNDEFINED;
+      _changed[output] = false;
+    }
+
+
+    /*
+      Reset all internal values, so that the behavior is like directly after the
+      instantiation and before first call of hasChanged(). The configuration
+      of the outputs is kept.
+    */
+    void reset(){
+      StablePoti::reset();
+      for(uint8_t i = 0 ; i < K ; i++){
+        resetOutput(i);
+      }
+    }
+};
+
+#endif
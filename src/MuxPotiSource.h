@@ -0,0 +1,255 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef MUX_POTI_SOURCE
+#define MUX_POTI_SOURCE
+
+#include "PotiSource.h"
+
+#define MUX_POTI_SOURCE_MAX_CHANNELS  16
+
+/*
+  The MuxPotiSource class is a source of raw values for potentiometers
+  that are connected by an analog multiplexer (e.g. 74HC4051 with 8
+  channels and 3 address pins or 74HC4067 with 16 channels and 4 address
+  pins) to one analog input pin.
+
+  After switching the address of the multiplexer, the analog signal needs
+  some time to settle before it can be measured (settleMicros). Instead of
+  waiting, the function update() returns immediately, when the settle time
+  is not yet over, so that the time can be used for other work. When the
+  settle time is over, update() measures the channel, stores the value and
+  switches to the next channel. The function update() must be called
+  continously, at least once per loop run.
+
+  The channels are scanned in the order of a gray code. When all
+  2^numAddressPins channels are used, only one address pin has to be
+  switched from one channel to the next channel. With fewer channels the
+  addresses of the unused channels are skipped, so some switches change
+  more than one address pin (e.g. channel 2 to 4 with 5 channels and 3
+  address pins). Only changed address pins are written.
+
+  The stored values are used by Poti objects of class SourcedPoti, e.g.
+  SourcedPoti<MappedPoti>, with the channel of the multiplexer.
+
+  The functions readAnalogValue() and writeAddressPin() can be overwritten
+  by a subclass, e.g. for a simulated multiplexer.
+
+  Advantages:
+  - no active waits (except in begin())
+  - one analog pin for up to 16 potentiometers
+  - one address pin change per channel, when all channels are used
+  - all Poti classes usable by SourcedPoti
+*/
+
+
+class MuxPotiSource : public PotiSource {
+
+  protected:
+
+    // analog input pin connected to the multiplexer, defined by parameter analogPin
+    uint8_t _analogPin;
+    // address pins of the multiplexer, defined by parameter addressPins
+    uint8_t _addressPins[4];
+    // number of address pins, defined by parameter numAddressPins
+    uint8_t _numAddressPins;
+    // number of used channels, defined by parameter numChannels
+    uint8_t _numChannels;
+    // settle time in microseconds after switching the address, defined by parameter settleMicros
+    uint16_t _settleMicros;
+    // current position in the gray code scan order
+    uint8_t _scanIndex;
+    // current address of the multiplexer
+    uint8_t _address;
+    // timestamp of the last address switch
+    unsigned long _switchMicros;
+    // last measured raw values of all channels
+    int _values[MUX_POTI_SOURCE_MAX_CHANNELS];
+
+
+    /*
+      Returns the analog value of the currently selected channel. The
+      function can be overwritten for implementing an own logic.
+
+      @returns  raw value from 0 to MAX (typically 1023) of the specific microcontroller
+    */
+    virtual int readAnalogValue(){
+      return analogRead(_analogPin);
+    }
+
+
+    /*
+      Sets an address pin of the multiplexer. The function can be
+      overwritten for implementing an own logic.
+
+      @param  pin     the address pin
+      @param  level   HIGH or LOW
+    */
+    virtual void writeAddressPin(uint8_t pin, uint8_t level){
+      digitalWrite(pin, level);
+    }
+
+
+    /*
+      Switches the multiplexer to the next channel in gray code order.
+      Only changed address pins are written.
+    */
+    void switchToNextChannel(){
+      uint8_t address, diff;
+
+      // next gray code address, that is a used channel
+      do{
+        _scanIndex = (_scanIndex + 1) & ((1 << _numAddressPins) - 1);
+        address = _scanIndex ^ (_scanIndex >> 1);
+      } while(address >= _numChannels);
+
+      diff = address ^ _address;
+      for(uint8_t i = 0 ; i < _numAddressPins ; i++){
+        if((diff & (1 << i)) != 0){
+          writeAddressPin(_addressPins[i], (address >> i) & 0x01);
+        }
+      }
+      _address = address;
+      _switchMicros = micros();
+    }
+
+
+  public:
+
+    /*
+      Create a new MuxPotiSource object for an analog multiplexer.
+
+      @param  analogPin         Analog pin connected to the multiplexer.
+                                Values for Arduino e.g. A0 to A7.
+      @param  addressPins       Array of the digital pins connected to the address
+                                inputs of the multiplexer, lowest address bit first.
+      @param  numAddressPins    Number of address pins. Values 1 to 4
+                                (e.g. 3 for 74HC4051, 4 for 74HC4067).
+      @param  numChannels       Number of used channels from 1 to 2^numAddressPins.
+                                Channels 0 to numChannels-1 are scanned.
+      @param  settleMicros      Time in microseconds to be waited after switching
+                                the address before measuring the channel.
+    */
+    MuxPotiSource(uint8_t analogPin, const uint8_t* addressPins, uint8_t numAddressPins,
+      uint8_t numChannels, uint16_t settleMicros){
+
+      _analogPin = analogPin;
+      _numAddressPins = numAddressPins;
+      _numChannels = numChannels;
+      _settleMicros = settleMicros;
+
+      if(_numAddressPins > 4){
+        _numAddressPins = 4;
+      }
+
+      if(_numAddressPins < 1){
+        _numAddressPins = 1;
+      }
+
+      if(_numChannels > (1 << _numAddressPins)){
+        _numChannels = 1 << _numAddressPins;
+      }
+
+      if(_numChannels < 1){
+        _numChannels = 1;
+      }
+
+      for(uint8_t i = 0 ; i < _numAddressPins ; i++){
+        _addressPins[i] = addressPins[i];
+      }
+
+      for(uint8_t i = 0 ; i < MUX_POTI_SOURCE_MAX_CHANNELS ; i++){
+        _values[i] = 0;
+      }
+
+      _scanIndex = 0;
+      _address = 0;
+      _switchMicros = 0;
+    }
+
+
+    /*
+      Configures the address pins and measures all channels once with
+      waiting for the settle times, so that valid values are available
+      before the first call of hasChanged() of the Poti objects.
+      Must be called in setup().
+    */
+    void begin(){
+      for(uint8_t i = 0 ; i < _numAddressPins ; i++){
+        pinMode(_addressPins[i], OUTPUT);
+        writeAddressPin(_addressPins[i], LOW);
+      }
+      _scanIndex = 0;
+      _address = 0;
+
+      for(uint8_t i = 0 ; i < _numChannels ; i++){
+        delayMicroseconds(_settleMicros);
+        _values[_address] = readAnalogValue();
+        switchToNextChannel();
+      }
+    }
+
+
+    /*
+      Measures the currently selected channel, if the settle time is over,
+      and switches to the next channel. Returns immediately without waiting
+      otherwise.
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  true, if a channel has been measured
+    */
+    bool update(){
+      if(micros() - _switchMicros < _settleMicros){
+        return false;
+      }
+
+      _values[_address] = readAnalogValue();
+      switchToNextChannel();
+      return true;
+    }
+
+
+    /*
+      Returns the last measured raw value of a channel.
+
+      @param    channel   channel of the multiplexer from 0 to numChannels-1
+      @returns            raw value from 0 to MAX (typically 1023) of the specific microcontroller
+    */
+    int getRawValue(uint8_t channel){
+      return _values[channel];
+    }
+
+
+    /*
+      Returns the number of used channels.
+
+      @returns  number of channels
+    */
+    uint8_t getNumChannels(){
+      return _numChannels;
+    }
+};
+
+#endif
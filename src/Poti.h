@@ -29,6 +29,17 @@
 
 #define POTI_VALUE_UNDEFINED    0x7FFF
 
+/*
+  Time source in milliseconds for all timing logic of the Poti classes.
+  Default is millis(). For simulations with a virtual clock, the macro
+  can be defined before the first include of a Poti class header (e.g.
+  #define POTI_MILLIS() virtualMillis). It must be the same definition
+  in all files of a sketch.
+*/
+#ifndef POTI_MILLIS
+#define POTI_MILLIS() millis()
+#endif
+
 /*
   The Poti class is used for easy handling of potentiometers, attenuators and
   other kinds of analog input signals.
@@ -86,7 +97,7 @@
   Advantages:
   - no active waits
   - high performance
-  - low memory usage per Poti instance (10 Byte)
+  - low memory usage per Poti instance (12 Byte with AVR)
   - handling current and previous state
   - value caching enables stable value analysis
   - easy handling in loops with little code
@@ -175,7 +186,7 @@ class Poti {
     */
     bool hasChanged(){
       int rawValue;
-      unsigned long current = millis();
+      unsigned long current = POTI_MILLIS();
 
       if(_readCycleMillis > 0 && _lastReadMillis > 0){
         if(current - _lastReadMillis < _readCycleMillis){
@@ -210,6 +221,48 @@ class Poti {
     }
 
 
+    /*
+      Returns the timestamp, from which on the next call of hasChanged()
+      will measure a raw value, e.g. for scheduling many Poti objects
+      (see PotiScheduler).
+
+      @returns  timestamp in milliseconds (POTI_MILLIS()), the current
+                time if the next call of hasChanged() will measure
+    */
+    unsigned long getNextReadMillis(){
+      if(_readCycleMillis == 0 || _lastReadMillis == 0){
+        return POTI_MILLIS();
+      }
+      return _lastReadMillis + _readCycleMillis;
+    }
+
+
+    /*
+      Moves the timestamp of the last measurement back to its scheduled
+      time, if it was measured less than readCycleMillis later, e.g. after
+      a long loop run. So the following measurements keep the phase of
+      the schedule (see PotiScheduler). Later measurements start a new
+      phase.
+
+      @param  scheduledMillis   scheduled timestamp of the last measurement
+    */
+    void alignReadMillis(unsigned long scheduledMillis){
+      if(scheduledMillis != 0 && _lastReadMillis - scheduledMillis < _readCycleMillis){
+        _lastReadMillis = scheduledMillis;
+      }
+    }
+
+
+    /*
+      Returns the minimum time between succeeding measurements.
+
+      @returns  readCycleMillis from 0 to 255
+    */
+    uint8_t getReadCycleMillis(){
+      return _readCycleMillis;
+    }
+
+
     /*
       Reset all internal values, so that the behavior is like directly after the
       instantiation and before first call of hasChanged().
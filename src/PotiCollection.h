@@ -0,0 +1,390 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef POTI_COLLECTION
+#define POTI_COLLECTION
+
+#include "CenteredPoti.h"
+#include "HalfShiftMappedPoti.h"
+#include "TaperedPoti.h"
+#include "WideMappedPoti.h"
+
+#define POTI_COLLECTION_FULL    0xFF
+
+#define POTI_TYPE_POTI          0
+#define POTI_TYPE_STABLE        1
+#define POTI_TYPE_MAPPED        2
+#define POTI_TYPE_CENTERED      3
+#define POTI_TYPE_HALF_SHIFT    4
+#define POTI_TYPE_TAPERED       5
+#define POTI_TYPE_WIDE_MAPPED   6
+#define POTI_TYPE_CUSTOM        7
+
+// operations of callPoti() for reset(), the mapping values and POTI_TYPE_CUSTOM
+#define POTI_COLLECTION_HAS_CHANGED   0
+#define POTI_COLLECTION_RESET         1
+#define POTI_COLLECTION_MAPPED        2
+#define POTI_COLLECTION_MAPPED_PREV   3
+
+/*
+  Type tag of a Poti class for the dispatch of PotiCollection. The tag is
+  determined for the class, that declares the used hasChanged() function.
+  All other classes (e.g. template classes like VelocityPoti, that hide
+  hasChanged()) get POTI_TYPE_CUSTOM.
+*/
+template<class D>
+struct PotiTypeTag {
+  static const uint8_t type = POTI_TYPE_CUSTOM;
+};
+
+template<> struct PotiTypeTag<Poti> { static const uint8_t type = POTI_TYPE_POTI; };
+template<> struct PotiTypeTag<StablePoti> { static const uint8_t type = POTI_TYPE_STABLE; };
+template<> struct PotiTypeTag<MappedPoti> { static const uint8_t type = POTI_TYPE_MAPPED; };
+template<> struct PotiTypeTag<CenteredPoti> { static const uint8_t type = POTI_TYPE_CENTERED; };
+template<> struct PotiTypeTag<HalfShiftMappedPoti> { static const uint8_t type = POTI_TYPE_HALF_SHIFT; };
+template<> struct PotiTypeTag<TaperedPoti> { static const uint8_t type = POTI_TYPE_TAPERED; };
+template<> struct PotiTypeTag<WideMappedPoti> { static const uint8_t type = POTI_TYPE_WIDE_MAPPED; };
+
+/*
+  The PotiCollection class updates up to N objects of different Poti
+  classes (given by template parameter N), e.g. StablePoti, MappedPoti
+  and CenteredPoti objects, with one call of hasChanged().
+
+  The function hasChanged() of the Poti classes is not virtual. Called by
+  a pointer of a base class (e.g. Poti*), the function of the base class
+  would be executed without the stabilization and mapping of the real
+  class. Therefore the collection stores a type tag with each object and
+  calls hasChanged() of the real class by a switch over the type tags,
+  without a virtual or indirect function call per object.
+
+  The type tag is determined by add() at compile time from the class, that
+  declares the hasChanged() function of the added object. So subclasses
+  like own subclasses with getRawValue() or SourcedPoti<MappedPoti> get the
+  tag of their library class. Objects of other classes, that declare an own
+  hasChanged() (e.g. VelocityPoti<StablePoti>, SnapshotPoti<MappedPoti> or
+  MultiMappedPoti<K>), get POTI_TYPE_CUSTOM and are called by a function,
+  that add() generates for their class. The mapping values are the ones
+  of the class MappedPoti or WideMappedPoti, if the object is derived
+  from them.
+
+  The objects are not copied and must exist as long as the collection.
+  The function hasChanged() must be called continously, at least once per
+  loop run. It returns true, if at least one object has changed. Then
+  hasChanged(index) tells, which objects have changed.
+
+  Advantages:
+  - no active waits
+  - one call for all objects of different Poti classes
+  - correct hasChanged() of the real class without virtual function calls
+  - memory usage with AVR per object (5 Byte and 1 Bit) plus per instance (1 Byte)
+  - access to the values and mapping values of all objects by index
+*/
+
+
+template<uint8_t N>
+class PotiCollection {
+
+  protected:
+
+    // added Poti objects
+    Poti* _potis[N];
+    // functions generated for the classes of the objects with POTI_TYPE_CUSTOM, see callPoti()
+    uint16_t (*_customCalls[N])(Poti*, uint8_t);
+    // type tags of the objects
+    uint8_t _types[N];
+    // change information of the objects of the last call of hasChanged()
+    uint8_t _changed[(N + 7) / 8];
+    // number of added objects
+    uint8_t _numPotis;
+
+    /*
+      Calls a function of an object of class P, that is hidden by the
+      class P or not available in class Poti. Used for reset(), the
+      mapping values and by a function pointer for POTI_TYPE_CUSTOM.
+
+      @param  poti        the object of class P
+      @param  operation   POTI_COLLECTION_HAS_CHANGED, _RESET, _MAPPED or
+                          _MAPPED_PREV
+      @returns            result of hasChanged(), the mapping value or 0
+    */
+    template<class P>
+    static uint16_t callPoti(Poti* poti, uint8_t operation){
+      P* real = static_cast<P*>(poti);
+
+      switch(operation){
+        case POTI_COLLECTION_HAS_CHANGED:
+          return real->hasChanged();
+        case POTI_COLLECTION_RESET:
+          real->reset();
+          return 0;
+        default:
+          return getPotiMapping(*real, operation == POTI_COLLECTION_MAPPED_PREV);
+      }
+    }
+
+
+    /*
+      Returns the type tag of the class D, that declares hasChanged().
+
+      @param    hasChanged  the hasChanged() function of the object
+      @returns              the type tag, e.g. POTI_TYPE_MAPPED
+    */
+    template<class D>
+    static uint8_t getTypeTag(bool (D::*)()){
+      return PotiTypeTag<D>::type;
+    }
+
+
+    /*
+      Calls hasChanged() of the real class of an object by its type tag.
+
+      @param    index   index of the object
+      @returns          result of hasChanged()
+    */
+    bool callHasChanged(uint8_t index){
+      Poti* poti = _potis[index];
+
+      switch(_types[index]){
+        case POTI_TYPE_POTI:
+          return poti->hasChanged();
+        case POTI_TYPE_STABLE:
+          return static_cast<StablePoti*>(poti)->hasChanged();
+        case POTI_TYPE_MAPPED:
+          return static_cast<MappedPoti*>(poti)->hasChanged();
+        case POTI_TYPE_CENTERED:
+          return static_cast<CenteredPoti*>(poti)->hasChanged();
+        case POTI_TYPE_HALF_SHIFT:
+          return static_cast<HalfShiftMappedPoti*>(poti)->hasChanged();
+        case POTI_TYPE_TAPERED:
+          return static_cast<TaperedPoti*>(poti)->hasChanged();
+        case POTI_TYPE_WIDE_MAPPED:
+          return static_cast<WideMappedPoti*>(poti)->hasChanged();
+        default:
+          return _customCalls[index](poti, POTI_COLLECTION_HAS_CHANGED);
+      }
+    }
+
+
+    /*
+      Calls reset() or the mapping values of the real class of an object
+      by its type tag.
+
+      @param    index       index of the object
+      @param    operation   POTI_COLLECTION_RESET, _MAPPED or _MAPPED_PREV
+      @returns              the mapping value or 0
+    */
+    uint16_t dispatch(uint8_t index, uint8_t operation){
+      Poti* poti = _potis[index];
+
+      switch(_types[index]){
+        case POTI_TYPE_POTI:
+          return callPoti<Poti>(poti, operation);
+        case POTI_TYPE_STABLE:
+          return callPoti<StablePoti>(poti, operation);
+        case POTI_TYPE_MAPPED:
+          return callPoti<MappedPoti>(poti, operation);
+        case POTI_TYPE_CENTERED:
+          return callPoti<CenteredPoti>(poti, operation);
+        case POTI_TYPE_HALF_SHIFT:
+          return callPoti<HalfShiftMappedPoti>(poti, operation);
+        case POTI_TYPE_TAPERED:
+          return callPoti<TaperedPoti>(poti, operation);
+        case POTI_TYPE_WIDE_MAPPED:
+          return callPoti<WideMappedPoti>(poti, operation);
+        default:
+          return _customCalls[index](poti, operation);
+      }
+    }
+
+
+  public:
+
+    /*
+      Create a new empty PotiCollection object for up to N objects.
+    */
+    PotiCollection(){
+      _numPotis = 0;
+      for(uint8_t i = 0 ; i < (N + 7) / 8 ; i++){
+        _changed[i] = 0;
+      }
+    }
+
+
+    /*
+      Adds an object of a Poti class to the collection. The type tag is
+      determined from the class of the object.
+
+      @param    poti    the object, must exist as long as the collection
+      @returns          index of the object from 0 to N-1 or
+                        POTI_COLLECTION_FULL, if N objects are already added
+    */
+    template<class P>
+    uint8_t add(P& poti){
+      if(_numPotis >= N){
+        return POTI_COLLECTION_FULL;
+      }
+
+      _potis[_numPotis] = &poti;
+      _customCalls[_numPotis] = &callPoti<P>;
+      _types[_numPotis] = getTypeTag(&P::hasChanged);
+      return _numPotis++;
+    }
+
+
+    /*
+      Returns the number of added objects.
+
+      @returns  number of objects from 0 to N
+    */
+    uint8_t getNumPotis(){
+      return _numPotis;
+    }
+
+
+    /*
+      Returns the type tag of an object.
+
+      @param    index   index of the object from 0 to getNumPotis()-1
+      @returns          type tag, e.g. POTI_TYPE_MAPPED or POTI_TYPE_CUSTOM
+    */
+    uint8_t getType(uint8_t index){
+      return _types[index];
+    }
+
+
+    /*
+      Returns an object of the collection. Only functions of class Poti,
+      that are not hidden by the real class, should be used by the pointer.
+
+      @param    index   index of the object from 0 to getNumPotis()-1
+      @returns          pointer to the object
+    */
+    Poti* getPoti(uint8_t index){
+      return _potis[index];
+    }
+
+
+    /*
+      Returns the information, if at least one object has changed. Calls
+      hasChanged() of the real class of all objects.
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  true, if at least one object has changed
+    */
+    bool hasChanged(){
+      bool changed = false;
+
+      for(uint8_t i = 0 ; i < (N + 7) / 8 ; i++){
+        _changed[i] = 0;
+      }
+
+      for(uint8_t i = 0 ; i < _numPotis ; i++){
+        if(callHasChanged(i)){
+          _changed[i >> 3] |= (1 << (i & 0x07));
+          changed = true;
+        }
+      }
+      return changed;
+    }
+
+
+    /*
+      Returns the information, if an object has changed by the last call
+      of hasChanged().
+
+      @param    index   index of the object from 0 to getNumPotis()-1
+      @returns          true, if the object has changed
+    */
+    bool hasChanged(uint8_t index){
+      return (_changed[index >> 3] & (1 << (index & 0x07))) != 0;
+    }
+
+
+    /*
+      Returns current value of an object.
+
+      @param    index   index of the object from 0 to getNumPotis()-1
+      @returns          current value or POTI_VALUE_UNDEFINED
+    */
+    int getValue(uint8_t index){
+      return _potis[index]->getValue();
+    }
+
+
+    /*
+      Returns previous value of an object.
+
+      @param    index   index of the object from 0 to getNumPotis()-1
+      @returns          previous value or POTI_VALUE_UNDEFINED
+    */
+    int getPrevValue(uint8_t index){
+      return _potis[index]->getPrevValue();
+    }
+
+
+    /*
+      Returns current mapping value of an object of MappedPoti, its
+      subclasses or WideMappedPoti.
+
+      @param    index   index of the object from 0 to getNumPotis()-1
+      @returns          current mapping value or POTI_MAPPING_UNDEFINED
+                        for objects without mapping (WIDE_POTI_MAPPING_UNDEFINED
+                        for WideMappedPoti)
+    */
+    uint16_t getMappedValue(uint8_t index){
+      return dispatch(index, POTI_COLLECTION_MAPPED);
+    }
+
+
+    /*
+      Returns previous mapping value of an object of MappedPoti, its
+      subclasses or WideMappedPoti.
+
+      @param    index   index of the object from 0 to getNumPotis()-1
+      @returns          previous mapping value or POTI_MAPPING_UNDEFINED
+                        for objects without mapping (WIDE_POTI_MAPPING_UNDEFINED
+                        for WideMappedPoti)
+    */
+    uint16_t getMappedPrevValue(uint8_t index){
+      return dispatch(index, POTI_COLLECTION_MAPPED_PREV);
+    }
+
+
+    /*
+      Reset all objects by reset() of their real class, so that the behavior
+      is like directly after the instantiation and before first call of
+      hasChanged(). The objects stay in the collection.
+    */
+    void reset(){
+      for(uint8_t i = 0 ; i < _numPotis ; i++){
+        dispatch(i, POTI_COLLECTION_RESET);
+      }
+      for(uint8_t i = 0 ; i < (N + 7) / 8 ; i++){
+        _changed[i] = 0;
+      }
+    }
+};
+
+#endif
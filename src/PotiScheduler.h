@@ -0,0 +1,421 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#ifndef POTI_SCHEDULER
+#define POTI_SCHEDULER
+
+#include "Poti.h"
+
+#define POTI_SCHEDULER_FULL   0xFFFF
+#define POTI_SCHEDULER_NONE   0xFFFF
+
+/*
+  Number of slots of the timer wheel, one slot per millisecond. Must be
+  a power of 2. It can be defined before the include, e.g. 256 for many
+  objects with long read cycles.
+*/
+#ifndef POTI_SCHEDULER_SLOTS
+#define POTI_SCHEDULER_SLOTS  32
+#endif
+
+/*
+  The PotiScheduler class calls hasChanged() of up to N objects of any
+  Poti classes only, when the objects will measure a raw value. Calling
+  hasChanged() of all objects in each loop run needs time for each object,
+  even if nothing is due because of readCycleMillis. With hundreds of
+  objects this time is relevant for the loop.
+
+  The scheduler keeps the time of the next measurement of each object
+  (getNextReadMillis() of the object) in a hashed timer wheel with one
+  slot per millisecond. The function poll() processes only the slots of
+  the milliseconds since the last call and calls hasChanged() of the due
+  objects. Objects with a time more than POTI_SCHEDULER_SLOTS milliseconds
+  ahead stay in their slot until they are due. The time of the next
+  measurement includes the additional measurements of addNumRawAvg with
+  1 millisecond difference. Objects with readCycleMillis 0 are called
+  once per millisecond.
+
+  Objects with the same readCycleMillis would measure all in the same
+  millisecond after the start or reset(), because nothing is measured
+  before. The scheduler staggers the first measurements of the objects
+  instead: object i starts i * readCycleMillis / getNumPotis() milliseconds
+  after the first poll() or reschedule(). So the measurements are spread
+  evenly over the read cycle.
+
+  The next measurement of an object is anchored to its scheduled time
+  (scheduled time + readCycleMillis), not to the time of the real call.
+  A measurement delayed by a long loop run or by setMaxReadsPerPoll() is
+  accounted at its scheduled time (see alignReadMillis() of Poti), so all
+  objects return to their phase after the delay. Only objects delayed by
+  readCycleMillis or more start a new phase with the real call.
+
+  The number of hasChanged() calls per poll() can be limited by
+  setMaxReadsPerPoll(), so that the duration of a loop run is bounded.
+  Due objects above the limit stay due and are called by the next poll()
+  calls, also within the same millisecond.
+
+  The changed objects of the last poll() are returned by getChanged() or
+  hasChanged(index). The objects must not be called directly by
+  hasChanged(), while they are added. After reset() of objects the
+  function reschedule() must be called.
+
+  Example for 2 objects:
+
+  PotiScheduler<2> scheduler;
+  scheduler.add(mappedPot);
+  scheduler.add(centeredPot);
+
+  if(scheduler.poll() > 0){
+    for(uint16_t k = 0 ; k < scheduler.getNumChanged() ; k++){
+      Poti* changed = scheduler.getPoti(scheduler.getChanged(k));
+    }
+  }
+*/
+template<uint16_t N>
+class PotiScheduler {
+
+  protected:
+
+    // added Poti objects
+    Poti* _potis[N];
+    // functions for hasChanged() and getNextReadMillis() of the real classes of the objects
+    bool (*_calls[N])(Poti*, bool, unsigned long, unsigned long&);
+    // scheduled timestamps of the next measurements of the objects
+    unsigned long _dueMillis[N];
+    // next object in the same slot or POTI_SCHEDULER_NONE
+    uint16_t _nextInSlot[N];
+    // indexes of the changed objects of the last poll()
+    uint16_t _changedList[N];
+    // first object of each slot or POTI_SCHEDULER_NONE
+    uint16_t _slots[POTI_SCHEDULER_SLOTS];
+    // change information of the objects of the last poll()
+    uint8_t _changed[(N + 7) / 8];
+    // number of added objects
+    uint16_t _numPotis;
+    // number of changed objects of the last poll()
+    uint16_t _numChanged;
+    // last processed millisecond of the timer wheel
+    unsigned long _wheelMillis;
+    // maximum number of hasChanged() calls per poll(), 0 for no limit
+    uint16_t _maxReads;
+    // true after the first staggered scheduling of all objects
+    bool _scheduled;
+
+    /*
+      Calls hasChanged() of an object of class P, if requested, and
+      returns the timestamp of its next measurement. A measurement is
+      accounted at its scheduled time.
+
+      @param  poti        the object of class P
+      @param  poll        true for calling hasChanged()
+      @param  dueMillis   scheduled timestamp of the measurement
+      @param  nextMillis  timestamp of the next measurement
+      @returns            result of hasChanged() or false
+    */
+    template<class P>
+    static bool callPoti(Poti* poti, bool poll, unsigned long dueMillis, unsigned long& nextMillis){
+      bool changed = false;
+
+      if(poll){
+        changed = static_cast<P*>(poti)->hasChanged();
+        poti->alignReadMillis(dueMillis);
+      }
+      nextMillis = static_cast<P*>(poti)->getNextReadMillis();
+      return changed;
+    }
+
+
+    /*
+      Inserts an object into the slot of its timestamp. Objects with
+      earlier timestamps are inserted into the slot of the earliest
+      millisecond, but keep their scheduled timestamp.
+
+      @param  index       index of the object
+      @param  dueMillis   scheduled timestamp of the next measurement
+      @param  minMillis   earliest millisecond for the slot
+    */
+    void schedule(uint16_t index, unsigned long dueMillis, unsigned long minMillis){
+      uint16_t slot = dueMillis & (POTI_SCHEDULER_SLOTS - 1);
+
+      if((long)(dueMillis - minMillis) < 0){
+        slot = minMillis & (POTI_SCHEDULER_SLOTS - 1);
+      }
+
+      _dueMillis[index] = dueMillis;
+      _nextInSlot[index] = _slots[slot];
+      _slots[slot] = index;
+    }
+
+
+    /*
+      Inserts an object with its next measurement, but not before its
+      staggered start within its read cycle.
+
+      @param  index     index of the object
+      @param  current   current timestamp
+    */
+    void scheduleStaggered(uint16_t index, unsigned long current){
+      unsigned long nextMillis;
+      unsigned long startMillis = current + (unsigned long)index * _potis[index]->getReadCycleMillis() / _numPotis;
+
+      _calls[index](_potis[index], false, 0, nextMillis);
+      if((long)(nextMillis - startMillis) < 0){
+        nextMillis = startMillis;
+      }
+      schedule(index, nextMillis, _wheelMillis + 1);
+    }
+
+
+    /*
+      Calls hasChanged() of the due objects of a slot and inserts
+      them into the slots of their next measurements. When the limit
+      of setMaxReadsPerPoll() is reached, the remaining due objects
+      stay in the slot.
+
+      @param  slotMillis  millisecond of the slot to be processed
+      @param  current     current timestamp
+      @param  reads       number of hasChanged() calls of the current poll()
+      @returns            false, if due objects are left because of the limit
+    */
+    bool processSlot(unsigned long slotMillis, unsigned long current, uint16_t& reads){
+      uint16_t slot = slotMillis & (POTI_SCHEDULER_SLOTS - 1);
+      uint16_t index = _slots[slot];
+      uint16_t next;
+      unsigned long nextMillis;
+      bool complete = true;
+
+      _slots[slot] = POTI_SCHEDULER_NONE;
+      while(index != POTI_SCHEDULER_NONE){
+        next = _nextInSlot[index];
+        if((long)(current - _dueMillis[index]) < 0){
+          // due in a later round of the wheel
+          schedule(index, _dueMillis[index], slotMillis);
+        }
+        else if(_maxReads > 0 && reads >= _maxReads){
+          // limit reached, still due for the next poll()
+          schedule(index, _dueMillis[index], slotMillis);
+          complete = false;
+        }
+        else{
+          reads++;
+          if(_calls[index](_potis[index], true, _dueMillis[index], nextMillis)){
+            _changed[index >> 3] |= (1 << (index & 0x07));
+            _changedList[_numChanged++] = index;
+          }
+          // readCycleMillis 0 and additional measurements once per millisecond
+          schedule(index, nextMillis, current + 1);
+        }
+        index = next;
+      }
+      return complete;
+    }
+
+
+  public:
+
+    /*
+      Create a new empty PotiScheduler object for up to N objects.
+    */
+    PotiScheduler(){
+      _numPotis = 0;
+      _numChanged = 0;
+      _wheelMillis = 0;
+      _maxReads = 0;
+      _scheduled = false;
+      for(uint16_t i = 0 ; i < POTI_SCHEDULER_SLOTS ; i++){
+        _slots[i] = POTI_SCHEDULER_NONE;
+      }
+      for(uint16_t i = 0 ; i < (N + 7) / 8 ; i++){
+        _changed[i] = 0;
+      }
+    }
+
+
+    /*
+      Adds an object of a Poti class to the scheduler. The objects are
+      scheduled with staggered starts by the first poll(). Objects added
+      later are due with their next measurement or staggered start.
+
+      @param    poti    the object, must exist as long as the scheduler
+      @returns          index of the object from 0 to N-1 or
+                        POTI_SCHEDULER_FULL, if N objects are already added
+    */
+    template<class P>
+    uint16_t add(P& poti){
+      if(_numPotis >= N){
+        return POTI_SCHEDULER_FULL;
+      }
+
+      _potis[_numPotis] = &poti;
+      _calls[_numPotis] = &callPoti<P>;
+      _numPotis++;
+      if(_scheduled){
+        scheduleStaggered(_numPotis - 1, POTI_MILLIS());
+      }
+      return _numPotis - 1;
+    }
+
+
+    /*
+      Limits the number of hasChanged() calls per poll(). Due objects
+      above the limit are called by the next poll() calls.
+
+      @param  maxReads  maximum number of calls per poll(), 0 for no limit
+    */
+    void setMaxReadsPerPoll(uint16_t maxReads){
+      _maxReads = maxReads;
+    }
+
+
+    /*
+      Returns the maximum number of hasChanged() calls per poll().
+
+      @returns  maximum number of calls, 0 for no limit
+    */
+    uint16_t getMaxReadsPerPoll(){
+      return _maxReads;
+    }
+
+
+    /*
+      Calls hasChanged() of all objects, that are due for a measurement
+      since the last call, but not more than setMaxReadsPerPoll() objects.
+      Returns immediately, if no time has passed and no due objects are
+      left by the limit.
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  number of changed objects
+    */
+    uint16_t poll(){
+      unsigned long current = POTI_MILLIS();
+      unsigned long steps;
+      uint16_t reads = 0;
+
+      if(!_scheduled){
+        reschedule();
+      }
+      steps = current - _wheelMillis;
+
+      for(uint16_t k = 0 ; k < _numChanged ; k++){
+        _changed[_changedList[k] >> 3] &= ~(1 << (_changedList[k] & 0x07));
+      }
+      _numChanged = 0;
+
+      if(steps == 0){
+        return 0;
+      }
+
+      // all slots once, if more time has passed than one round of the wheel
+      if(steps > POTI_SCHEDULER_SLOTS){
+        steps = POTI_SCHEDULER_SLOTS;
+      }
+
+      for(unsigned long t = current - steps + 1 ; t != current + 1 ; t++){
+        if(!processSlot(t, current, reads)){
+          // continue with the same millisecond by the next poll()
+          _wheelMillis = t - 1;
+          return _numChanged;
+        }
+      }
+      _wheelMillis = current;
+      return _numChanged;
+    }
+
+
+    /*
+      Returns the number of changed objects of the last poll().
+
+      @returns  number of changed objects
+    */
+    uint16_t getNumChanged(){
+      return _numChanged;
+    }
+
+
+    /*
+      Returns the index of a changed object of the last poll().
+
+      @param    k   number of the change from 0 to getNumChanged()-1
+      @returns      index of the changed object
+    */
+    uint16_t getChanged(uint16_t k){
+      return _changedList[k];
+    }
+
+
+    /*
+      Returns the information, if an object has changed by the last poll().
+
+      @param    index   index of the object from 0 to getNumPotis()-1
+      @returns          true, if hasChanged() of the object returned true
+    */
+    bool hasChanged(uint16_t index){
+      return (_changed[index >> 3] & (1 << (index & 0x07))) != 0;
+    }
+
+
+    /*
+      Returns the number of added objects.
+
+      @returns  number of objects from 0 to N
+    */
+    uint16_t getNumPotis(){
+      return _numPotis;
+    }
+
+
+    /*
+      Returns an added object, e.g. for getValue() or for a cast to the
+      real class.
+
+      @param    index   index of the object from 0 to getNumPotis()-1
+      @returns          the object
+    */
+    Poti* getPoti(uint16_t index){
+      return _potis[index];
+    }
+
+
+    /*
+      Schedules all objects new with their next measurements or staggered
+      starts, e.g. after reset() of objects or after changing their
+      readCycleMillis.
+    */
+    void reschedule(){
+      unsigned long current = POTI_MILLIS();
+
+      for(uint16_t i = 0 ; i < POTI_SCHEDULER_SLOTS ; i++){
+        _slots[i] = POTI_SCHEDULER_NONE;
+      }
+      _wheelMillis = current - 1;
+      for(uint16_t i = 0 ; i < _numPotis ; i++){
+        scheduleStaggered(i, current);
+      }
+      _scheduled = true;
+    }
+};
+
+#endif
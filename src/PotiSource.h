@@ -0,0 +1,102 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef POTI_SOURCE
+#define POTI_SOURCE
+
+#include "Poti.h"
+
+/*
+  The PotiSource class is the base class for all sources of raw values,
+  that deliver the values of several channels, e.g. analog multiplexers
+  or external A/D converters. Subclasses implement getRawValue(channel).
+
+  A source is used by Poti objects of the template class SourcedPoti.
+  SourcedPoti can be combined with every Poti class (e.g.
+  SourcedPoti<MappedPoti>) and replaces the analogRead() of the default
+  getRawValue() by the value of a channel of the source. The channel
+  number is given instead of the inputPin parameter of the Poti class,
+  so no additional memory except the pointer to the source is needed.
+
+  Example for a MappedPoti on channel 3 of a source:
+
+  SourcedPoti<MappedPoti> pot = SourcedPoti<MappedPoti>(&source, 3, 100, 0, 0, 10, 0);
+*/
+
+
+class PotiSource {
+
+  public:
+
+    /*
+      Returns the raw value of a channel of the source.
+
+      @param    channel   channel of the source
+      @returns            raw value from 0 to MAX of the source
+    */
+    virtual int getRawValue(uint8_t channel) = 0;
+};
+
+
+/*
+  Template class for using a Poti class (given by template parameter P)
+  with the raw values of a channel of a PotiSource. All parameters
+  after source are the same as for the constructor of P, only inputPin
+  is replaced by the channel of the source.
+*/
+template<class P>
+class SourcedPoti : public P {
+
+  protected:
+
+    // source of the raw values, defined by parameter source
+    PotiSource* _source;
+
+    /*
+      Returns the raw value of the channel from the source.
+
+      @returns  raw value from 0 to MAX of the source
+    */
+    int getRawValue(){
+      return _source->getRawValue(this->_inputPin);
+    }
+
+  public:
+
+    /*
+      Create a new Poti object of class P, that uses the raw values of a
+      channel of a source instead of an analog input pin.
+
+      @param  source    Source of the raw values.
+      @param  channel   Channel of the source, used as inputPin of class P.
+      @param  args      All further parameters of the constructor of class P.
+    */
+    template<typename... Args>
+    SourcedPoti(PotiSource* source, uint8_t channel, Args... args) :
+      P(channel, args...){
+      _source = source;
+    }
+};
+
+#endif
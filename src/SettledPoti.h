@@ -0,0 +1,209 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#ifndef SETTLED_POTI
+#define SETTLED_POTI
+
+#include "MappedPoti.h"
+
+#define SETTLED_POTI_DEFAULT_MILLIS   500
+
+/*
+  Template class for adding a settled state to a Poti class (given by
+  template parameter P), e.g. SettledPoti<MappedPoti> or
+  SettledPoti<StablePoti>. All parameters of the constructor are the
+  same as for the constructor of P.
+
+  While the potentiometer is turned, hasChanged() reports each change
+  and the values of getValue() and getMappedValue() can be used as
+  preview, e.g. for a fast display. When no change has been measured for
+  settleMillis milliseconds (default SETTLED_POTI_DEFAULT_MILLIS), the
+  current values are committed as settled values and hasSettled()
+  returns true once. So expensive actions (e.g. writing to EEPROM or
+  sending over a slow bus) are done only once per turn. A turn, that
+  ends with the committed mapping value (or value for classes without
+  mapping), is not reported again.
+
+  The function hasSettled() must be called continously after
+  hasChanged(), at least once per loop run.
+
+  The additional memory usage per instance is 11 Byte with AVR.
+
+  Example for a MappedPoti with settled values:
+
+  SettledPoti<MappedPoti> pot = SettledPoti<MappedPoti>(A7, 10, 4, 0, 10, 0);
+*/
+template<class P>
+class SettledPoti : public P {
+
+  protected:
+
+    // timestamp of the measurement of the last change
+    unsigned long _changeMillis;
+    // milliseconds without change for settling, defined by setSettleMillis()
+    uint16_t _settleMillis;
+    // last committed value
+    int _settledValue;
+    // last committed mapping value
+    uint16_t _settledMappedValue;
+    // true, if a change is not yet settled
+    bool _settlePending;
+
+
+  public:
+
+    /*
+      Create a new Poti object of class P with settled values.
+
+      @param  args      All parameters of the constructor of class P.
+    */
+    template<typename... Args>
+    SettledPoti(Args... args) : P(args...){
+      _settleMillis = SETTLED_POTI_DEFAULT_MILLIS;
+      _changeMillis = 0;
+      _settledValue = POTI_VALUE_UNDEFINED;
+      _settledMappedValue = POTI_MAPPING_UNDEFINED;
+      _settlePending = false;
+    }
+
+
+    /*
+      Returns the information, if value has changed between this and the
+      previous call like hasChanged() of class P. Additionally the time
+      of the change is stored for the settling.
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  true, if current value has changed or when called
+                first time
+    */
+    bool hasChanged(){
+      if(P::hasChanged()){
+        _changeMillis = this->_lastReadMillis;
+        _settlePending = true;
+        return true;
+      }
+      return false;
+    }
+
+
+    /*
+      Returns the information, if the values have settled since the
+      previous call. The current values are committed as settled values,
+      when no change has been measured for settleMillis milliseconds and
+      the mapping value (or the value for classes without mapping)
+      differs from the last committed one.
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  true, if new settled values have been committed
+    */
+    bool hasSettled(){
+      uint16_t mappedValue;
+
+      if(!_settlePending || POTI_MILLIS() - _changeMillis < _settleMillis){
+        return false;
+      }
+
+      _settlePending = false;
+      mappedValue = getPotiMapping(*this, false);
+
+      if(mappedValue == _settledMappedValue &&
+        (mappedValue != POTI_MAPPING_UNDEFINED || this->getValue() == _settledValue)){
+        return false;
+      }
+
+      _settledValue = this->getValue();
+      _settledMappedValue = mappedValue;
+      return true;
+    }
+
+
+    /*
+      Returns the information, if a change is waiting for settling.
+
+      @returns  true, while the potentiometer is turned
+    */
+    bool isSettling(){
+      return _settlePending;
+    }
+
+
+    /*
+      Sets the time without changes, after that the values are settled.
+
+      @param  settleMillis  milliseconds from 0 to 65535
+    */
+    void setSettleMillis(uint16_t settleMillis){
+      _settleMillis = settleMillis;
+    }
+
+
+    /*
+      Returns the time without changes, after that the values are settled.
+
+      @returns  milliseconds
+    */
+    uint16_t getSettleMillis(){
+      return _settleMillis;
+    }
+
+
+    /*
+      Returns the last committed value.
+
+      @returns  settled value or POTI_VALUE_UNDEFINED before first settling
+    */
+    int getSettledValue(){
+      return _settledValue;
+    }
+
+
+    /*
+      Returns the last committed mapping value.
+
+      @returns  settled mapping value or POTI_MAPPING_UNDEFINED before first
+                settling and for classes without mapping
+    */
+    uint16_t getSettledMappedValue(){
+      return _settledMappedValue;
+    }
+
+
+    /*
+      Reset all internal values, so that the behavior is like directly after the
+      instantiation and before first call of hasChanged(). The settled values
+      are undefined again, the settle time is not changed.
+    */
+    void reset(){
+      P::reset();
+      _changeMillis = 0;
+      _settledValue = POTI_VALUE_UNDEFINED;
+      _settledMappedValue = POTI_MAPPING_UNDEFINED;
+      _settlePending = false;
+    }
+};
+
+#endif
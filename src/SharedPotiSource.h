@@ -0,0 +1,143 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#ifndef SHARED_POTI_SOURCE
+#define SHARED_POTI_SOURCE
+
+#include "PotiSource.h"
+
+#define SHARED_POTI_SOURCE_MAX_PINS   8
+#define SHARED_POTI_SOURCE_NO_PIN     0xFF
+
+/*
+  The SharedPotiSource class is a source of raw values for several Poti
+  objects that are connected to the same analog input pins, e.g. a raw
+  view, a 10 step mapping and a 100 step mapping of one potentiometer.
+
+  The channel of the source is the analog input pin. The first Poti object
+  that requests the value of a pin within a millisecond (tick of
+  POTI_MILLIS()) triggers the analogRead(). All further requests for the
+  same pin within the same tick get the cached value without a new
+  conversion. So co-located Poti objects with the same readCycleMillis
+  share one conversion per read cycle.
+
+  The cache holds up to SHARED_POTI_SOURCE_MAX_PINS pins. Requests for
+  additional pins are read directly without caching.
+
+  The function readAnalogValue() can be overwritten by a subclass, e.g.
+  for simulated values.
+
+  Example for two mappings of the potentiometer at pin A7:
+
+  SharedPotiSource source = SharedPotiSource();
+  SourcedPoti<MappedPoti> pot10 = SourcedPoti<MappedPoti>(&source, A7, 100, 0, 0, 10, 0);
+  SourcedPoti<MappedPoti> pot100 = SourcedPoti<MappedPoti>(&source, A7, 100, 0, 0, 100, 0);
+
+  Advantages:
+  - no active waits
+  - one conversion per pin and tick for all Poti objects
+  - all Poti classes usable by SourcedPoti
+*/
+
+
+class SharedPotiSource : public PotiSource {
+
+  protected:
+
+    // cached pins, SHARED_POTI_SOURCE_NO_PIN for unused entries
+    uint8_t _pins[SHARED_POTI_SOURCE_MAX_PINS];
+    // tick (value of POTI_MILLIS()) of the cached values
+    unsigned long _ticks[SHARED_POTI_SOURCE_MAX_PINS];
+    // cached raw values of the pins
+    int _values[SHARED_POTI_SOURCE_MAX_PINS];
+
+
+    /*
+      Returns the analog value of an input pin. The function can be
+      overwritten for implementing an own logic.
+
+      @param    pin   analog input pin
+      @returns        raw value from 0 to MAX (typically 1023) of the specific microcontroller
+    */
+    virtual int readAnalogValue(uint8_t pin){
+      return analogRead(pin);
+    }
+
+
+  public:
+
+    /*
+      Create a new SharedPotiSource object with an empty cache.
+    */
+    SharedPotiSource(){
+      reset();
+    }
+
+
+    /*
+      Returns the raw value of an analog input pin. Within the same tick
+      of POTI_MILLIS() the pin is read only once.
+
+      @param    channel   analog input pin, e.g. A0 to A7
+      @returns            raw value from 0 to MAX (typically 1023) of the specific microcontroller
+    */
+    int getRawValue(uint8_t channel){
+      unsigned long current = POTI_MILLIS();
+      uint8_t i;
+
+      for(i = 0 ; i < SHARED_POTI_SOURCE_MAX_PINS ; i++){
+        if(_pins[i] == channel || _pins[i] == SHARED_POTI_SOURCE_NO_PIN){
+          break;
+        }
+      }
+
+      // cache full
+      if(i == SHARED_POTI_SOURCE_MAX_PINS){
+        return readAnalogValue(channel);
+      }
+
+      if(_pins[i] != channel || _ticks[i] != current){
+        _pins[i] = channel;
+        _ticks[i] = current;
+        _values[i] = readAnalogValue(channel);
+      }
+      return _values[i];
+    }
+
+
+    /*
+      Clears the cache, so that the next request of each pin reads
+      a new value.
+    */
+    void reset(){
+      for(uint8_t i = 0 ; i < SHARED_POTI_SOURCE_MAX_PINS ; i++){
+        _pins[i] = SHARED_POTI_SOURCE_NO_PIN;
+        _ticks[i] = 0;
+        _values[i] = 0;
+      }
+    }
+};
+
+#endif
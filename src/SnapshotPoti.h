@@ -0,0 +1,194 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef SNAPSHOT_POTI
+#define SNAPSHOT_POTI
+
+#include "MappedPoti.h"
+
+/*
+  Barrier for the order of the memory accesses of the snapshot logic.
+  With AVR (single core) a barrier for the compiler is sufficient. For
+  other architectures the full memory barrier of the compiler is used,
+  e.g. for reading the snapshots by a second core or thread. It can be
+  defined before the include for own implementations.
+*/
+#ifndef POTI_MEMORY_BARRIER
+#if defined(__AVR__)
+#define POTI_MEMORY_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define POTI_MEMORY_BARRIER() __sync_synchronize()
+#endif
+#endif
+
+/*
+  Consistent set of values of a Poti object after a change. The mapping
+  values are POTI_MAPPING_UNDEFINED for classes without mapping.
+*/
+struct PotiSnapshot {
+  int value;
+  int prevValue;
+  uint16_t mappedValue;
+  uint16_t prevMappedValue;
+};
+
+
+/*
+  Template class for publishing the values of a Poti class (given by
+  template parameter P) as consistent snapshots, e.g. SnapshotPoti<MappedPoti>
+  or SnapshotPoti<StablePoti>. All parameters of the constructor are the
+  same as for the constructor of P.
+
+  The values of the Poti classes are changed by hasChanged() and are not
+  read atomically (e.g. 16 bit values with AVR). An interrupt service
+  routine (ISR) or a second core or thread, that reads the values while
+  hasChanged() is running in loop(), could get inconsistent values. With
+  each change reported by hasChanged() the current and previous value and
+  mapping value are published as snapshot (PotiSnapshot). The function
+  getSnapshot() returns always a consistent snapshot without disabling
+  the interrupts and without waiting for hasChanged().
+
+  The snapshots are stored in two buffers. The function hasChanged()
+  writes the new snapshot into the unused buffer and publishes it by
+  incrementing a sequence number of 1 Byte, that is written atomically.
+  The function getSnapshot() copies the published buffer and repeats the
+  copy, if the sequence number has changed during the copy (only possible
+  with a second core or thread, not in an ISR). Only one caller of
+  hasChanged() is allowed.
+
+  The additional memory usage per instance is 17 Byte with AVR.
+
+  Example for a MappedPoti with snapshots:
+
+  SnapshotPoti<MappedPoti> pot = SnapshotPoti<MappedPoti>(A7, 10, 4, 0, 10, 0);
+*/
+template<class P>
+class SnapshotPoti : public P {
+
+  protected:
+
+    // two buffers for the snapshots, the published one is given by _snapshotSeq
+    volatile int _snapValue[2];
+    volatile int _snapPrevValue[2];
+    volatile uint16_t _snapMappedValue[2];
+    volatile uint16_t _snapPrevMappedValue[2];
+    // sequence number of the published snapshot, its lowest bit is the published buffer
+    volatile uint8_t _snapshotSeq;
+
+    /*
+      Writes the current values into the unused buffer and publishes it.
+    */
+    void publishSnapshot(){
+      uint8_t i = (_snapshotSeq + 1) & 0x01;
+
+      _snapValue[i] = this->getValue();
+      _snapPrevValue[i] = this->getPrevValue();
+      _snapMappedValue[i] = getPotiMapping(*this, false);
+      _snapPrevMappedValue[i] = getPotiMapping(*this, true);
+      POTI_MEMORY_BARRIER();
+      _snapshotSeq = _snapshotSeq + 1;
+    }
+
+
+  public:
+
+    /*
+      Create a new Poti object of class P with published snapshots.
+
+      @param  args      All parameters of the constructor of class P.
+    */
+    template<typename... Args>
+    SnapshotPoti(Args... args) : P(args...){
+      _snapshotSeq = 0;
+      publishSnapshot();
+    }
+
+
+    /*
+      Returns the information, if value has changed between this and the
+      previous call like hasChanged() of class P. Additionally a new
+      snapshot is published for each change.
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  true, if current value has changed or when called
+                first time
+    */
+    bool hasChanged(){
+      if(P::hasChanged()){
+        publishSnapshot();
+        return true;
+      }
+      return false;
+    }
+
+
+    /*
+      Copies the last published snapshot. The function can be called
+      in an ISR or by another core or thread.
+
+      @param  snapshot  the snapshot to be filled
+      @returns          sequence number of the snapshot
+    */
+    uint8_t getSnapshot(PotiSnapshot& snapshot){
+      uint8_t seq;
+
+      do{
+        seq = _snapshotSeq;
+        POTI_MEMORY_BARRIER();
+        snapshot.value = _snapValue[seq & 0x01];
+        snapshot.prevValue = _snapPrevValue[seq & 0x01];
+        snapshot.mappedValue = _snapMappedValue[seq & 0x01];
+        snapshot.prevMappedValue = _snapPrevMappedValue[seq & 0x01];
+        POTI_MEMORY_BARRIER();
+      } while(seq != _snapshotSeq);
+
+      return seq;
+    }
+
+
+    /*
+      Returns the sequence number of the last published snapshot. The
+      number is incremented with each change and can be used for detecting
+      new snapshots without copying them.
+
+      @returns  sequence number from 0 to 255
+    */
+    uint8_t getSnapshotSeq(){
+      return _snapshotSeq;
+    }
+
+
+    /*
+      Reset all internal values, so that the behavior is like directly after the
+      instantiation and before first call of hasChanged(). A snapshot with the
+      undefined values is published.
+    */
+    void reset(){
+      P::reset();
+      publishSnapshot();
+    }
+};
+
+#endif
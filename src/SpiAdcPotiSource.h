@@ -0,0 +1,242 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef SPI_ADC_POTI_SOURCE
+#define SPI_ADC_POTI_SOURCE
+
+#include <SPI.h>
+#include "PotiSource.h"
+
+#define SPI_ADC_MCP3008     10
+#define SPI_ADC_MCP3208     12
+#define SPI_ADC_CLOCK_HZ    1000000
+
+/*
+  The SpiAdcPotiSource class is a source of raw values for potentiometers
+  that are connected to an external A/D converter with SPI interface and
+  8 channels, like MCP3008 (10 bit) or MCP3208 (12 bit).
+
+  The function update() reads all used channels of the A/D converter in
+  one burst (one SPI transaction) and stores the values. The stored values
+  are used by Poti objects of class SourcedPoti, e.g. SourcedPoti<MappedPoti>,
+  with the channel of the A/D converter. So each scan needs only one SPI
+  transaction instead of one per Poti object. The function update() must be
+  called continously, at least once per loop run. The scans are limited by
+  readCycleMillis like the reads of the Poti classes.
+
+  For the 12 bit MCP3208 the maximum analog value of the mapped Poti
+  classes must be set by setMaxAnalogValue(4095).
+
+  The functions transfer() and selectChip() can be overwritten by a
+  subclass, e.g. for a simulated A/D converter.
+
+  Advantages:
+  - no active waits
+  - one SPI transaction for all channels
+  - 10 and 12 bit A/D converters
+  - all Poti classes usable by SourcedPoti
+*/
+
+
+class SpiAdcPotiSource : public PotiSource {
+
+  protected:
+
+    // chip select pin of the A/D converter, defined by parameter csPin
+    uint8_t _csPin;
+    // resolution of the A/D converter, SPI_ADC_MCP3008 or SPI_ADC_MCP3208
+    uint8_t _resolution;
+    // number of used channels, defined by parameter numChannels
+    uint8_t _numChannels;
+    // milliseconds defined by parameter readCycleMillis
+    uint8_t _readCycleMillis;
+    // timestamp of last scan, for implementation of _readCycleMillis
+    unsigned long _lastReadMillis;
+    // last measured raw values of all channels
+    int _values[8];
+
+
+    /*
+      Sends and receives one byte by SPI. The function can be overwritten
+      for implementing an own logic.
+
+      @param    data    byte to be sent
+      @returns          received byte
+    */
+    virtual uint8_t transfer(uint8_t data){
+      return SPI.transfer(data);
+    }
+
+
+    /*
+      Selects or deselects the A/D converter by the chip select pin. The
+      function can be overwritten for implementing an own logic.
+
+      @param  selected  true for selecting the chip (chip select pin LOW)
+    */
+    virtual void selectChip(bool selected){
+      digitalWrite(_csPin, selected ? LOW : HIGH);
+    }
+
+
+    /*
+      Reads one channel of the A/D converter. Each conversion is started
+      by selecting the chip.
+
+      @param    channel   channel from 0 to 7
+      @returns            raw value of the channel
+    */
+    int readChannel(uint8_t channel){
+      uint8_t high, low;
+
+      selectChip(true);
+      if(_resolution == SPI_ADC_MCP3208){
+        // start bit, single ended, channel bit 2, then channel bits 1 and 0
+        transfer(0x06 | (channel >> 2));
+        high = transfer((channel & 0x03) << 6) & 0x0F;
+      }
+      else{
+        // start bit, then single ended and channel bits
+        transfer(0x01);
+        high = transfer(0x80 | (channel << 4)) & 0x03;
+      }
+      low = transfer(0x00);
+      selectChip(false);
+
+      return (high << 8) | low;
+    }
+
+
+  public:
+
+    /*
+      Create a new SpiAdcPotiSource object for an A/D converter with SPI
+      interface.
+
+      @param  csPin             Digital pin connected to chip select of the
+                                A/D converter.
+      @param  resolution        SPI_ADC_MCP3008 for 10 bit or SPI_ADC_MCP3208
+                                for 12 bit A/D converters.
+      @param  numChannels       Number of used channels from 1 to 8.
+                                Channels 0 to numChannels-1 are read.
+      @param  readCycleMillis   Minimum time in milliseconds that must have been
+                                waited between succeeding scans of the channels.
+                                Values from 0 to 255. Value 0 means no waits.
+    */
+    SpiAdcPotiSource(uint8_t csPin, uint8_t resolution, uint8_t numChannels, uint8_t readCycleMillis){
+      _csPin = csPin;
+      _resolution = (resolution == SPI_ADC_MCP3208 ? SPI_ADC_MCP3208 : SPI_ADC_MCP3008);
+      _numChannels = numChannels;
+      _readCycleMillis = readCycleMillis;
+      _lastReadMillis = 0;
+
+      if(_numChannels > 8){
+        _numChannels = 8;
+      }
+
+      if(_numChannels < 1){
+        _numChannels = 1;
+      }
+
+      for(uint8_t i = 0 ; i < 8 ; i++){
+        _values[i] = 0;
+      }
+    }
+
+
+    /*
+      Configures the chip select pin and SPI and reads all channels once,
+      so that valid values are available before the first call of
+      hasChanged() of the Poti objects. Must be called in setup().
+    */
+    void begin(){
+      pinMode(_csPin, OUTPUT);
+      selectChip(false);
+      SPI.begin();
+      _lastReadMillis = 0;
+      update();
+    }
+
+
+    /*
+      Reads all channels in one SPI transaction, if the time defined by
+      readCycleMillis is over. Returns immediately without waiting otherwise.
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  true, if the channels have been read
+    */
+    bool update(){
+      unsigned long current = POTI_MILLIS();
+
+      if(_readCycleMillis > 0 && _lastReadMillis > 0){
+        if(current - _lastReadMillis < _readCycleMillis){
+          return false;
+        }
+      }
+
+      _lastReadMillis = current;
+
+      SPI.beginTransaction(SPISettings(SPI_ADC_CLOCK_HZ, MSBFIRST, SPI_MODE0));
+      for(uint8_t i = 0 ; i < _numChannels ; i++){
+        _values[i] = readChannel(i);
+      }
+      SPI.endTransaction();
+      return true;
+    }
+
+
+    /*
+      Returns the last measured raw value of a channel.
+
+      @param    channel   channel of the A/D converter from 0 to numChannels-1
+      @returns            raw value from 0 to 1023 (MCP3008) or 4095 (MCP3208)
+    */
+    int getRawValue(uint8_t channel){
+      return _values[channel];
+    }
+
+
+    /*
+      Returns the maximum raw value of the A/D converter, e.g. for
+      setMaxAnalogValue() of the mapped Poti classes.
+
+      @returns  1023 (MCP3008) or 4095 (MCP3208)
+    */
+    int getMaxAnalogValue(){
+      return (1 << _resolution) - 1;
+    }
+
+
+    /*
+      Returns the number of used channels.
+
+      @returns  number of channels
+    */
+    uint8_t getNumChannels(){
+      return _numChannels;
+    }
+};
+
+#endif
@@ -60,7 +60,7 @@
   Advantages:
   - no active waits
   - high performance
-  - memory usage per StablePoti instance (17 Byte)
+  - memory usage per StablePoti instance (19 Byte with AVR)
   - handling current and previous value
   - value caching enables stable value analysis
   - easy handling in loops with little code
@@ -98,7 +98,7 @@ class StablePoti : public Poti {
     */
     int getStabilizedRawValue(){
       int rawValue, j;
-      unsigned long current = millis();
+      unsigned long current = POTI_MILLIS();
 
       // processing with a minimum time difference defined by _readCycleMillis
       // but allowing additional measurements defined by _addNumRawAvg and
@@ -233,6 +233,21 @@ class StablePoti : public Poti {
       return false;
     }
 
+    /*
+      Returns the timestamp, from which on the next call of hasChanged()
+      will measure a raw value. During the additional measurements of
+      addNumRawAvg this is 1 millisecond after the last measurement.
+
+      @returns  timestamp in milliseconds (POTI_MILLIS()), the current
+                time if the next call of hasChanged() will measure
+    */
+    unsigned long getNextReadMillis(){
+      if(_openNumRawAvg > 0){
+        return _lastReadMillis + 1;
+      }
+      return Poti::getNextReadMillis();
+    }
+
     /*
       Reset all internal values, so that the behavior is like directly after the
       instantiation and before first call of hasChanged().
@@ -0,0 +1,313 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef STABLE_POTI_BANK
+#define STABLE_POTI_BANK
+
+#include "Poti.h"
+
+/*
+  The StablePotiBank class handles N analog inputs with identical
+  configuration in one object. The stabilization logic is exactly the
+  same as in the StablePoti class (average of additional measurements
+  and weighting with the previous value), so that every channel delivers
+  the same values as an own StablePoti object with the same parameters.
+
+  Instead of one object per potentiometer, the internal values of all
+  channels are kept in separate arrays (current value, previous value,
+  internal previous value, sum of the average calculation). All channels
+  are read together and the calculation is done in one loop per step over
+  these arrays. The timing (readCycleMillis and the 1 millisecond delays
+  of addNumRawAvg) is the same for all channels and therefore handled only
+  once for the whole bank.
+
+  The function hasChanged() must be called continously, at least once per
+  loop run. It returns true, if at least one channel has changed. Then
+  hasChanged(channel) tells, which channels have changed.
+
+  The function getRawValue(channel) can be overwritten by a subclass, so
+  that a possibility is given to use whatever input for the channels.
+
+  Advantages:
+  - no active waits
+  - high performance for a big number of channels
+  - memory usage with AVR per channel (10 Byte) plus per instance (11 Byte)
+  - handling current and previous values
+  - identical values as with StablePoti objects
+  - reduction of raw value reads (optional)
+  - subclasses for own raw read logic possible (optional)
+  - stabilization by calculating average of measurements (optional)
+  - stabilization by weighting previous and current value (optional)
+*/
+
+
+template<uint8_t N>
+class StablePotiBank {
+
+  protected:
+
+    // to be used analog input pins, defined by parameter inputPins
+    uint8_t _inputPins[N];
+    // milliseconds defined by parameter readCycleMillis
+    uint8_t _readCycleMillis;
+    // timestamp of last measurement of the potentiometer values, for implementation of _readCycleMillis
+    unsigned long _lastReadMillis;
+
+    // number of measurements, for building an average raw value, by parameter _addNumRawAvg
+    uint8_t _addNumRawAvg;
+    // number of currently still necessary measurements required by parameter _addNumRawAvg (0 -> nothing left)
+    uint8_t _openNumRawAvg;
+    // true, when the first measurement after instantiation or reset is done
+    bool _rawAvgStarted;
+    // weight defined by parameter weightPrev
+    uint8_t _weightPrev;
+
+    // internal sum of unmapped potentiometer values per channel during processing of raw average logic
+    int _internalRawAvg[N];
+    // internal previous potentiometer value per channel during processing of weighting logic
+    int _prevValueInternal[N];
+    // current unmapped potentiometer value per channel for external requests/use
+    int _curValue[N];
+    // previous unmapped potentiometer value per channel for external requests/use
+    int _prevValue[N];
+    // change information per channel of the last call of hasChanged()
+    bool _changed[N];
+
+
+    /*
+      Returns the raw analog value of one channel. The function can be
+      overwritten for implementing an own logic.
+
+      In this default implementation the value is read by an A/D converter
+      of the used microcontroller with analogRead() of the input pin
+      of the channel.
+
+      @param    channel   channel from 0 to N-1
+      @returns            raw value from 0 to MAX (typically 1023) of the specific microcontroller
+    */
+    virtual int getRawValue(uint8_t channel){
+      return analogRead(_inputPins[channel]);
+    }
+
+
+  public:
+
+    /*
+      Create a new StablePotiBank object to handle the input of N analog
+      input pins with identical stabilization.
+
+      @param  inputPins         Array of N analog pins for reading the analog raw
+                                values. Values for Arduino e.g. A0 to A7.
+      @param  readCycleMillis   Minimum time in milliseconds that must have been
+                                waited between succeeding reads of all channels.
+                                Values from 0 to 255. Value 0 means no waits.
+      @param  weightPrev        Weight of the previous value, when the new output
+                                value is calculated as combined value.
+                                Values 0 to 12. Value 0 means no weighting logic.
+      @param  addNumRawAvg      Additional nummer of raw value measurements for
+                                building an average with first measurement.
+                                Values 0 to 7. Value 0 means no average calculation.
+    */
+    StablePotiBank(const uint8_t* inputPins, uint8_t readCycleMillis, uint8_t weightPrev, uint8_t addNumRawAvg){
+      for(uint8_t i = 0 ; i < N ; i++){
+        _inputPins[i] = inputPins[i];
+      }
+      _readCycleMillis = readCycleMillis;
+      _weightPrev = weightPrev;
+      _addNumRawAvg = addNumRawAvg;
+
+      if(_weightPrev > 12){
+        _weightPrev = 12;
+      }
+
+      if(_addNumRawAvg > 7){
+        _addNumRawAvg = 7;
+      }
+
+      reset();
+    }
+
+
+    /*
+      Returns the number of channels of the bank.
+
+      @returns  number of channels N
+    */
+    uint8_t getNumChannels(){
+      return N;
+    }
+
+
+    /*
+      Returns the information, if the value of at least one channel has
+      changed between this and the previous call.
+
+      The function must be called continously, at least once per loop run. It
+      will measure raw values of all channels, calculate stabilization, identify
+      changes and set current and previous values.
+
+      @returns  true, if at least one current value has changed or when called first time
+    */
+    bool hasChanged(){
+      int rawValue[N];
+      int value, j;
+      bool changed = false;
+      unsigned long current = POTI_MILLIS();
+
+      // changes of the previous call are no longer valid, also without measurement
+      for(uint8_t i = 0 ; i < N ; i++){
+        _changed[i] = false;
+      }
+
+      // same timing logic as in StablePoti, but once for all channels
+      if(_openNumRawAvg == 0){
+        if(_readCycleMillis > 0 && _lastReadMillis > 0){
+          if(current - _lastReadMillis < _readCycleMillis){
+            return false;
+          }
+        }
+      }
+      else {
+        // additional measures with 1 ms difference
+        if(current - _lastReadMillis < 1){
+          return false;
+        }
+      }
+
+      _lastReadMillis = current;
+
+      for(uint8_t i = 0 ; i < N ; i++){
+        rawValue[i] = getRawValue(i);
+      }
+
+      // do a number of additional measurements and then take an average as raw value
+      if(_addNumRawAvg > 0){
+        if(!_rawAvgStarted){
+          // first measurement after instantiation or reset
+          _rawAvgStarted = true;
+        }
+        else if(_openNumRawAvg == 0){
+          // first measurement of addNumRawAvg done, additional measurements to be initialized
+          _openNumRawAvg = _addNumRawAvg;
+          for(uint8_t i = 0 ; i < N ; i++){
+            _internalRawAvg[i] = rawValue[i];
+          }
+          return false;
+        }
+        else{
+          // next addtional measurement of addNumRawAvg
+          for(uint8_t i = 0 ; i < N ; i++){
+            _internalRawAvg[i] += rawValue[i];
+          }
+          if(--_openNumRawAvg > 0){
+            return false;
+          }
+          // last measurement of the sequence, now average calculation with rounding
+          j = _addNumRawAvg + 1;
+          for(uint8_t i = 0 ; i < N ; i++){
+            rawValue[i] = ((_internalRawAvg[i] * 2) + j) / (j * 2);
+          }
+        }
+      }
+
+      // weighting of previous and new value like in StablePoti and
+      // identification of changes
+      j = _weightPrev + 4;
+      for(uint8_t i = 0 ; i < N ; i++){
+        value = rawValue[i];
+        if(_weightPrev > 0 && _prevValueInternal[i] != POTI_VALUE_UNDEFINED){
+          value = ((value * 4) + (_prevValueInternal[i] * _weightPrev) + (j / 2)) / j;
+        }
+        _prevValueInternal[i] = value;
+
+        if(value != _curValue[i]){
+          _prevValue[i] = _curValue[i];
+          _curValue[i] = value;
+          _changed[i] = true;
+          changed = true;
+        }
+      }
+      return changed;
+    }
+
+
+    /*
+      Returns the information, if the value of the channel has changed
+      by the last call of hasChanged().
+
+      @param    channel   channel from 0 to N-1
+      @returns            true, if current value of the channel has changed
+    */
+    bool hasChanged(uint8_t channel){
+      return _changed[channel];
+    }
+
+
+    /*
+      Returns current value of a channel. The value was calculated and set
+      by the last call of hasChanged() that changed the channel.
+
+      @param    channel   channel from 0 to N-1
+      @returns            current value from 0 to MAX (typically 1023) of the specific
+                          microcontroller or POTI_VALUE_UNDEFINED before first
+                          call of hasChanged().
+    */
+    int getValue(uint8_t channel){
+      return _curValue[channel];
+    }
+
+
+    /*
+      Returns previous value of a channel. This previous value was the
+      current value before the last change of the channel.
+
+      @param    channel   channel from 0 to N-1
+      @returns            previous value from 0 to MAX (typically 1023) of the specific
+                          microcontroller or POTI_VALUE_UNDEFINED before the channel
+                          has changed two times
+    */
+    int getPrevValue(uint8_t channel){
+      return _prevValue[channel];
+    }
+
+
+    /*
+      Reset all internal values, so that the behavior is like directly after the
+      instantiation and before first call of hasChanged().
+    */
+    void reset(){
+      for(uint8_t i = 0 ; i < N ; i++){
+        _internalRawAvg[i] = POTI_VALUE_UNDEFINED;
+        _prevValueInternal[i] = POTI_VALUE_UNDEFINED;
+        _curValue[i] = POTI_VALUE_UNDEFINED;
+        _prevValue[i] = POTI_VALUE_UNDEFINED;
+        _changed[i] = false;
+      }
+      _lastReadMillis = 0;
+      _openNumRawAvg = 0;
+      _rawAvgStarted = false;
+    }
+};
+
+#endif
@@ -0,0 +1,311 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef TAPERED_POTI
+#define TAPERED_POTI
+
+#include "MappedPoti.h"
+
+/*
+  Based on the Poti, StablePoti and MappedPoti classes and all its advantages
+  the TaperedPoti class replaces the stretching of MappedPoti by a user defined
+  taper curve. With the taper curve any not linear distribution of analog
+  values can be corrected, e.g. of logarithmical potentiometers or of worn
+  linear potentiometers.
+
+  The taper curve is defined by a table of breakpoints. Each breakpoint is a
+  pair of a raw analog value and the corrected analog value (output) that the
+  raw value shall have with an ideal linear potentiometer. Between two
+  breakpoints the corrected value is calculated by linear interpolation with
+  integer calculation. The raw values of the breakpoints must be ascending.
+  Raw values below the first or above the last breakpoint get the output of
+  the first or last breakpoint. The table is stored as uint16_t array in flash
+  memory (PROGMEM), so that it doesn't need RAM and can be shared by several
+  TaperedPoti objects.
+
+  Example for a logarithmical potentiometer (about 10% analog value at the
+  middle position):
+
+  const uint16_t LOG_TAPER[] PROGMEM = {0, 0, 102, 512, 1023, 1023};
+
+  The corrected value is mapped with the linear mapping of MappedPoti. The
+  search of the relevant breakpoints starts always at the breakpoints of the
+  last calculation, so that in case of normal movements of the potentiometer
+  the search is done with very few steps.
+
+  The external view is the same like for MappedPoti. The analog values of
+  getValue() and getPrevValue() are the uncorrected values and
+  getTaperedValue() returns the corrected current value. The hysteresis of
+  setHysteresis() is given in uncorrected analog values. The ranges of
+  getRawRangeForMapping() are also uncorrected analog values, e.g. for the
+  targets of motorized faders. They are found by inverting the taper curve,
+  so the corrected values of the table must be ascending too.
+
+  Advantages:
+  - no active waits
+  - high performance
+  - memory usage per TaperedPoti instance (32 Byte with AVR)
+  - handling current and previous value
+  - value caching enables stable value analysis
+  - easy handling in loops with little code
+  - reduction of raw value reads (optional)
+  - subclasses for own raw read logic possible (optional)
+  - stabilization by calculating average of measurements (optional)
+  - stabilization by weighting previous and current value (optional)
+  - stabilization by mapping analog values
+  - compensation for any distribution of analog values by taper tables
+  - hysteresis at the mapping boundaries (optional)
+*/
+
+
+class TaperedPoti : public MappedPoti {
+
+  protected:
+
+    // taper table in flash memory with pairs of raw value and output value
+    const uint16_t* _taper;
+    // number of breakpoints (pairs) in the taper table
+    uint8_t _numPoints;
+    // index of the first breakpoint of the last used table segment
+    uint8_t _segment;
+
+    /*
+      Calculates the corrected analog value based on the taper table.
+
+      @param      rawValue        the analog input value that has to be corrected
+      @returns                    corrected analog value
+    */
+    int getTapering(int rawValue){
+      long rawLow, rawHigh, outLow, outHigh;
+
+      if(_numPoints == 0){
+        return rawValue;
+      }
+
+      if(rawValue <= (int)pgm_read_word(&_taper[0])){
+        _segment = 0;
+        return pgm_read_word(&_taper[1]);
+      }
+
+      if(rawValue >= (int)pgm_read_word(&_taper[(_numPoints - 1) * 2])){
+        _segment = _numPoints - 1;
+        return pgm_read_word(&_taper[(_numPoints - 1) * 2 + 1]);
+      }
+
+      // incremental search starting with the last used segment
+      if(_segment > _numPoints - 2){
+        _segment = _numPoints - 2;
+      }
+      while(rawValue < (int)pgm_read_word(&_taper[_segment * 2])){
+        _segment--;
+      }
+      while(rawValue >= (int)pgm_read_word(&_taper[(_segment + 1) * 2])){
+        _segment++;
+      }
+
+      rawLow = pgm_read_word(&_taper[_segment * 2]);
+      outLow = pgm_read_word(&_taper[_segment * 2 + 1]);
+      rawHigh = pgm_read_word(&_taper[(_segment + 1) * 2]);
+      outHigh = pgm_read_word(&_taper[(_segment + 1) * 2 + 1]);
+
+      return outLow + (rawValue - rawLow) * (outHigh - outLow) / (rawHigh - rawLow);
+    }
+
+
+    /*
+      Returns the lowest uncorrected analog value, that is mapped to the
+      mapping value or a higher one. The taper curve is inverted by a
+      binary search with the same integer calculation as hasChanged().
+
+      @param      mapValue        the mapping value
+      @returns                    lowest analog value or maxAnalogVal+1,
+                                  if the mapping value is not reached
+    */
+    int getTaperedBoundary(uint8_t mapValue){
+      int low = 0;
+      int high = _maxAnalogVal + 1;
+      int middle;
+
+      while(low < high){
+        middle = (low + high) / 2;
+        if(getMapping(getTapering(middle), 0, 0) < mapValue){
+          low = middle + 1;
+        }
+        else{
+          high = middle;
+        }
+      }
+      return low;
+    }
+
+
+  public:
+
+    /*
+      Create a new TaperedPoti object to handle the input of an analog input pin,
+      correct the analog values by a taper table and map the corrected values
+      to a defined rang of mapping values.
+
+      Parameter weightPrev defines weight of previous value. Current value has
+      fixed weight of 4. The higher the value, the more stable and slower
+      will the output value change.
+
+      Parameter addNumRawAvg value x>0 means x+1 measurements are done and
+      calculation is x milliseconds delayed (no active waiting). Each
+      additional measurement adds 1 millisecond delay before final calculation.
+
+      @param  inputPin          Analog pin for reading the analog raw value.
+                                Possible pin configuration must be done before
+                                hasChanged() calls. Values for Arduino e.g. A0 to A7.
+      @param  readCycleMillis   Minimum time in milliseconds that must have been
+                                waited between succeeding calls of getRawValue().
+                                Values from 0 to 255. Value 0 means no waits and
+                                getRawvalue() is called by each hasChanged() call.
+      @param  weightPrev        Weight of the previous value, when the new output
+                                value is calculated as combined value.
+                                Values 0 to 12. Value 0 means no weighting logic.
+      @param  addNumRawAvg      Additional nummer of raw value measurements for
+                                building an average with first measurement.
+                                Values 0 to 7. Value 0 means no average calculation.
+      @param  numMapping        Number of mapping values. Range is from 2 to 100.
+      @param  taper             Taper table in flash memory (PROGMEM) with pairs
+                                of raw value and corrected value. Raw values must
+                                be ascending. Corrected values from 0 to maxAnalogVal.
+      @param  numPoints         Number of pairs in the taper table. Value 0 means
+                                no correction.
+    */
+    TaperedPoti(uint8_t inputPin, uint8_t readCycleMillis, uint8_t weightPrev, uint8_t addNumRawAvg,
+      uint8_t numMapping, const uint16_t* taper, uint8_t numPoints) :
+      MappedPoti(inputPin, readCycleMillis, weightPrev, addNumRawAvg, numMapping, 0){
+
+      _taper = taper;
+      _numPoints = numPoints;
+      _segment = 0;
+    }
+
+
+    /*
+      Returns the information, if mapping value has changed between this
+      and the previous call.
+
+      The function must be called continously, at least once per loop run. It
+      will measure raw values, calculate stabilization, correction and mapping,
+      identify changes and set current and previous values and mappings.
+
+      @returns  true, if current mapping value has changed or when called
+                first time
+    */
+    bool hasChanged(){
+      int internalPrevVal = _prevValueInternal;
+      int rawValue = getStabilizedRawValue();
+      uint8_t mapValue;
+
+      if(rawValue == POTI_VALUE_UNDEFINED){
+        return false;
+      }
+
+      // no change by current measurement?
+      if(rawValue == internalPrevVal){
+        return false;
+      }
+
+      mapValue = getMapping(getTapering(rawValue), 0, 0);
+
+      // boundary not crossed by more than the hysteresis?
+      if(isHysteresisRelevant(mapValue)){
+        if(getMapping(getTapering(getHysteresisValue(rawValue, mapValue)), 0, 0) == _curMapValue){
+          return false;
+        }
+      }
+
+      // Mapping-Wechsel?
+      if(mapValue != _curMapValue){
+        _prevValue = _curValue;
+        _curValue = rawValue;
+        _prevMapValue = _curMapValue;
+        _curMapValue = mapValue;
+        return true;
+      }
+      return false;
+    }
+
+
+    /*
+      Calculates the mapping values for a whole array of analog values
+      at once, e.g. for a recorded trace or for generating a table of
+      all analog values 0 to maxAnalogVal. Each analog value is corrected
+      and mapped on its own like the first value of hasChanged(), the
+      hysteresis of setHysteresis() is not applied.
+
+      The function doesn't read any raw values and doesn't change any
+      current or previous values of the object.
+
+      @param  rawValues   array of num analog values from 0 to maxAnalogVal
+      @param  mapValues   array for num resulting mapping values
+      @param  num         number of values to be mapped
+    */
+    void getMappings(const int* rawValues, uint8_t* mapValues, size_t num){
+      for(size_t i = 0 ; i < num ; i++){
+        mapValues[i] = getMapping(getTapering(rawValues[i]), 0, 0);
+      }
+    }
+
+
+    /*
+      Returns the range of uncorrected analog values of a mapping value,
+      e.g. for the feedback of LED rings or for the target of motorized
+      faders. The taper curve is inverted, the hysteresis is not included.
+
+      @param    mapValue  mapping value from 0 to getNumMappingValues()-1
+      @param    low       lowest analog value of the mapping value
+      @param    high      highest analog value of the mapping value,
+                          low-1 for a not reached mapping value
+      @returns            true, if the mapping value is reached by any analog value
+    */
+    bool getRawRangeForMapping(uint8_t mapValue, int& low, int& high){
+      if(mapValue > _numMapping){
+        mapValue = _numMapping;
+      }
+      low = getTaperedBoundary(mapValue);
+      high = getTaperedBoundary(mapValue + 1) - 1;
+      return low <= high;
+    }
+
+
+    /*
+      Returns the corrected current value based on the taper table and
+      the analog value given by getValue().
+
+      @returns  corrected current value from 0 to maxAnalogVal
+                or POTI_VALUE_UNDEFINED before first call of hasChanged()
+    */
+    int getTaperedValue(){
+      if(_curValue == POTI_VALUE_UNDEFINED){
+        return POTI_VALUE_UNDEFINED;
+      }
+      return getTapering(_curValue);
+    }
+};
+
+#endif
@@ -0,0 +1,204 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef THRESHOLD_POTI
+#define THRESHOLD_POTI
+
+#include "Poti.h"
+
+/*
+  Template class for reducing the changes reported by hasChanged() of
+  a Poti class without mapping (given by template parameter P), e.g.
+  ThresholdPoti<StablePoti> or ThresholdPoti<Poti>. All parameters of
+  the constructor are the same as for the constructor of P.
+
+  With setChangeThreshold() the reporting of changes can be reduced for
+  noisy inputs without reducing the resolution. Changes of at least
+  minDelta to the current value are reported immediately. Smaller
+  changes are only reported, when the measured value has been steady
+  for at least holdMillis milliseconds. Each different measured value
+  restarts the hold time. Default is reporting every change.
+
+  The mapped classes report changes of the mapping values only and are
+  not intended to be used as class P, setHysteresis() is the
+  corresponding function for them.
+
+  The additional memory usage per instance is 7 Byte with AVR.
+
+  Example for a StablePoti, that reports changes of at least 8 analog
+  values immediately and smaller changes after 200 milliseconds:
+
+  ThresholdPoti<StablePoti> pot = ThresholdPoti<StablePoti>(A7, 10, 4, 0);
+  pot.setChangeThreshold(8, 200);
+*/
+template<class P>
+class ThresholdPoti : public P {
+
+  protected:
+
+    // value of a smaller change, that waits for _holdMillis, POTI_VALUE_UNDEFINED if none
+    int _pendingValue;
+    // time in milliseconds for reporting smaller changes, defined by setChangeThreshold()
+    uint16_t _holdMillis;
+    // lower 16 bit of the timestamp, when the waiting value was measured first
+    uint16_t _pendingMillis;
+    // minimum difference to the current value for immediate reporting, defined by setChangeThreshold()
+    uint8_t _minDelta;
+
+
+    /*
+      Checks, if a new measured value shall be reported as change based on
+      the threshold and hold time defined by setChangeThreshold().
+
+      @param    value     measured value, the waiting value if there is
+                          no new one
+      @param    current   timestamp of the check
+      @returns            true, if the value shall be set as current value
+    */
+    bool isReportableChange(int value, unsigned long current){
+      int delta;
+
+      if(value == this->_curValue){
+        _pendingValue = POTI_VALUE_UNDEFINED;
+        return false;
+      }
+
+      delta = value - this->_curValue;
+      if(delta < 0){
+        delta = -delta;
+      }
+
+      if(this->_curValue == POTI_VALUE_UNDEFINED || delta >= _minDelta){
+        _pendingValue = POTI_VALUE_UNDEFINED;
+        return true;
+      }
+
+      if(_holdMillis == 0){
+        return false;
+      }
+
+      // smaller change, the hold time (re)starts with each different value
+      if(value != _pendingValue){
+        _pendingValue = value;
+        _pendingMillis = (uint16_t)this->_lastReadMillis;
+        return false;
+      }
+
+      if((uint16_t)((uint16_t)current - _pendingMillis) >= _holdMillis){
+        _pendingValue = POTI_VALUE_UNDEFINED;
+        return true;
+      }
+      return false;
+    }
+
+
+  public:
+
+    /*
+      Create a new Poti object of class P with a change threshold.
+
+      @param  args      All parameters of the constructor of class P.
+    */
+    template<typename... Args>
+    ThresholdPoti(Args... args) : P(args...){
+      _pendingValue = POTI_VALUE_UNDEFINED;
+      _holdMillis = 0;
+      _pendingMillis = 0;
+      _minDelta = 1;
+    }
+
+
+    /*
+      Defines, which changes are reported by hasChanged(). Changes of at
+      least minDelta are reported immediately. Smaller changes are reported,
+      when the measured value has been steady for at least holdMillis
+      milliseconds. The first value is always reported.
+
+      @param  minDelta    Minimum difference to the current value. Values from
+                          1 to 255. Value 1 (default) reports every change.
+      @param  holdMillis  Time in milliseconds for reporting smaller changes.
+                          Value 0 (default) means smaller changes are never
+                          reported.
+    */
+    void setChangeThreshold(uint8_t minDelta, uint16_t holdMillis){
+      _minDelta = (minDelta < 1 ? 1 : minDelta);
+      _holdMillis = holdMillis;
+      _pendingValue = POTI_VALUE_UNDEFINED;
+    }
+
+
+    /*
+      Returns the information, if value has changed between this and the
+      previous call like hasChanged() of class P, but only for changes
+      allowed by setChangeThreshold().
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  true, if current value has changed or when called
+                first time
+    */
+    bool hasChanged(){
+      int curValue = this->_curValue;
+      int prevValue = this->_prevValue;
+      int value;
+
+      // class P identifies a new measured value by the difference to the waiting one
+      if(_pendingValue != POTI_VALUE_UNDEFINED){
+        this->_curValue = _pendingValue;
+      }
+
+      if(P::hasChanged()){
+        value = this->_curValue;
+      }
+      else if(_pendingValue != POTI_VALUE_UNDEFINED){
+        value = _pendingValue;
+      }
+      else{
+        return false;
+      }
+
+      this->_curValue = curValue;
+      this->_prevValue = prevValue;
+
+      if(isReportableChange(value, POTI_MILLIS())){
+        this->_prevValue = curValue;
+        this->_curValue = value;
+        return true;
+      }
+      return false;
+    }
+
+
+    /*
+      Reset all internal values, so that the behavior is like directly after the
+      instantiation and before first call of hasChanged(). The threshold and
+      the hold time are not changed.
+    */
+    void reset(){
+      P::reset();
+      _pendingValue = POTI_VALUE_UNDEFINED;
+    }
+};
+
+#endif
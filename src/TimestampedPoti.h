@@ -0,0 +1,113 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#ifndef TIMESTAMPED_POTI
+#define TIMESTAMPED_POTI
+
+#include "Poti.h"
+
+/*
+  Template class for adding the timestamp of the last change to a Poti
+  class (given by template parameter P), e.g. TimestampedPoti<StablePoti>
+  or TimestampedPoti<MappedPoti>. All parameters of the constructor are
+  the same as for the constructor of P.
+
+  With each change reported by hasChanged(), the timestamp (POTI_MILLIS())
+  of the raw value measurement, that caused the change, is stored. With
+  averaging (addNumRawAvg) this is the last measurement of the average.
+  The timestamp doesn't depend on the time, when hasChanged() is called
+  after the measurement, and can be used for measuring the latency
+  between a movement of the potentiometer and the reported change.
+
+  The additional memory usage per instance is 4 Byte with AVR.
+
+  Example for a MappedPoti with timestamps:
+
+  TimestampedPoti<MappedPoti> pot = TimestampedPoti<MappedPoti>(A7, 10, 4, 0, 10, 0);
+*/
+template<class P>
+class TimestampedPoti : public P {
+
+  protected:
+
+    // timestamp of the measurement of the last change
+    unsigned long _changeMillis;
+
+
+  public:
+
+    /*
+      Create a new Poti object of class P with timestamps of the changes.
+
+      @param  args      All parameters of the constructor of class P.
+    */
+    template<typename... Args>
+    TimestampedPoti(Args... args) : P(args...){
+      _changeMillis = 0;
+    }
+
+
+    /*
+      Returns the information, if value has changed between this and the
+      previous call like hasChanged() of class P. Additionally the timestamp
+      of the measurement is stored for each change.
+
+      The function must be called continously, at least once per loop run.
+
+      @returns  true, if current value has changed or when called
+                first time
+    */
+    bool hasChanged(){
+      if(P::hasChanged()){
+        _changeMillis = this->_lastReadMillis;
+        return true;
+      }
+      return false;
+    }
+
+
+    /*
+      Returns the timestamp of the raw value measurement, that caused
+      the last change reported by hasChanged().
+
+      @returns  timestamp in milliseconds (POTI_MILLIS()) or 0 before
+                first change
+    */
+    unsigned long getChangeMillis(){
+      return _changeMillis;
+    }
+
+
+    /*
+      Reset all internal values, so that the behavior is like directly after the
+      instantiation and before first call of hasChanged().
+    */
+    void reset(){
+      P::reset();
+      _changeMillis = 0;
+    }
+};
+
+#endif
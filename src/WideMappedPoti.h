@@ -0,0 +1,368 @@
+/*
+  MIT License
+
+  Copyright (c) 2025-2026 Kay Kasper
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef WIDE_MAPPED_POTI
+#define WIDE_MAPPED_POTI
+
+#include "StablePoti.h"
+
+#define WIDE_POTI_MAPPING_UNDEFINED  0xFFFF
+#define WIDE_POTI_MAX_MAPPING        4096
+
+/*
+  Based on the Poti and StablePoti classes and all its advantages the
+  WideMappedPoti class maps the analog values linear to a wide range of
+  up to 4096 mapping values, e.g. all 4096 values of a 12 bit A/D converter
+  or the 1024 values of 10 bit for high resolution MIDI or OSC controls.
+  The mapping values are 16 bit values (uint16_t) and
+  WIDE_POTI_MAPPING_UNDEFINED marks the undefined mapping value.
+
+  The range of mapping values is defined as 0 to numMapping - 1 and the
+  analog values are distributed equally (no stretching and no automatic
+  center like with MappedPoti). Mapping value k includes all analog values
+  from (k * (maxAnalogVal + 1)) / numMapping (rounded up) to the first
+  analog value of mapping value k + 1 minus 1. When numMapping is higher
+  than the number of analog values, some mapping values are never reached.
+
+  The mapping is calculated by integer arithmetic. The lowest and highest
+  analog value of the current mapping value are cached, so that in most
+  calls of hasChanged() only two comparisons are needed to detect, that the
+  mapping value hasn't changed. Only if the analog value is outside of the
+  cached range, the new mapping value and its range are calculated once.
+  So the costs of the mapping are independent of the number of mapping values.
+
+  Advantages:
+  - no active waits
+  - high performance
+  - memory usage per WideMappedPoti instance (32 Byte with AVR) without
+    floating point functions
+  - handling current and previous value
+  - up to 4096 mapping values
+  - constant mapping costs independent of the number of mapping values
+  - reduction of raw value reads (optional)
+  - subclasses for own raw read logic possible (optional)
+  - stabilization by calculating average of measurements (optional)
+  - stabilization by weighting previous and current value (optional)
+  - hysteresis at the mapping boundaries (optional)
+*/
+
+
+class WideMappedPoti : public StablePoti {
+
+  protected:
+
+    // mapped value for external requests/use based on _curValue
+    uint16_t _curMapValue;
+    // mapped value for external requests/use based on _prevValue
+    uint16_t _prevMapValue;
+    // number of requested mapping values, defined by parameter numMapping
+    uint16_t _numMapping;
+    // number of analog values, that a mapping boundary must be crossed for a change, defined by setHysteresis()
+    uint8_t _hysteresis;
+    // maximum value that the analog read function can deliver, often and default is 1023
+    int _maxAnalogVal;
+    // lowest analog value of the current mapping value
+    int _mapLowVal;
+    // highest analog value of the current mapping value
+    int _mapHighVal;
+
+    /*
+      Calculates the current mapping value and its range of analog values
+      for the given analog value.
+
+      @param      rawValue        the analog input value that has to be mapped
+    */
+    void updateMapping(int rawValue){
+      _curMapValue = calcWideMapping(rawValue, _numMapping, _maxAnalogVal);
+      _mapLowVal = calcWideBoundary(_curMapValue, _numMapping, _maxAnalogVal);
+      _mapHighVal = calcWideBoundary(_curMapValue + 1, _numMapping, _maxAnalogVal) - 1;
+    }
+
+
+  public:
+
+    /*
+      Calculation of the linear mapping value suitable for the given analog
+      value (rawValue). The function can be used without an object, e.g.
+      for calculating tables.
+
+      @param      rawValue        the analog input value from 0 to maxAnalogVal
+      @param      numMapping      number of mapping values from 2 to 4096
+      @param      maxAnalogVal    maximum analog value, uneven number
+      @returns                    mapped value suitable for the rawValue
+    */
+    static uint16_t calcWideMapping(int rawValue, uint16_t numMapping, int maxAnalogVal){
+      return (uint16_t)(((unsigned long)rawValue * numMapping) / ((unsigned long)maxAnalogVal + 1));
+    }
+
+
+    /*
+      Calculation of the lowest analog value of a mapping value. The value
+      for numMapping is the first analog value above maxAnalogVal.
+
+      @param      mapValue        mapping value from 0 to numMapping
+      @param      numMapping      number of mapping values from 2 to 4096
+      @param      maxAnalogVal    maximum analog value, uneven number
+      @returns                    lowest analog value of the mapping value
+    */
+    static int calcWideBoundary(uint16_t mapValue, uint16_t numMapping, int maxAnalogVal){
+      return (int)(((unsigned long)mapValue * ((unsigned long)maxAnalogVal + 1) + numMapping - 1) / numMapping);
+    }
+
+
+    /*
+      Create a new WideMappedPoti object to handle the input of an analog input
+      pin and map the analog values linear to a wide range of mapping values.
+
+      Parameter weightPrev defines weight of previous value. Current value has
+      fixed weight of 4. The higher the value, the more stable and slower
+      will the output value change.
+
+      Parameter addNumRawAvg value x>0 means x+1 measurements are done and
+      calculation is x milliseconds delayed (no active waiting). Each
+      additional measurement adds 1 millisecond delay before final calculation.
+
+      @param  inputPin          Analog pin for reading the analog raw value.
+                                Possible pin configuration must be done before
+                                hasChanged() calls. Values for Arduino e.g. A0 to A7.
+      @param  readCycleMillis   Minimum time in milliseconds that must have been
+                                waited between succeeding calls of getRawValue().
+                                Values from 0 to 255. Value 0 means no waits and
+                                getRawvalue() is called by each hasChanged() call.
+      @param  weightPrev        Weight of the previous value, when the new output
+                                value is calculated as combined value.
+                                Values 0 to 12. Value 0 means no weighting logic.
+      @param  addNumRawAvg      Additional nummer of raw value measurements for
+                                building an average with first measurement.
+                                Values 0 to 7. Value 0 means no average calculation.
+      @param  numMapping        Number of mapping values. Range is from 2 to 4096.
+    */
+    WideMappedPoti(uint8_t inputPin, uint8_t readCycleMillis, uint8_t weightPrev, uint8_t addNumRawAvg,
+      uint16_t numMapping) :
+      StablePoti(inputPin, readCycleMillis, weightPrev, addNumRawAvg){
+
+      _curMapValue = WIDE_POTI_MAPPING_UNDEFINED;
+      _prevMapValue = WIDE_POTI_MAPPING_UNDEFINED;
+      _numMapping = numMapping;
+      _maxAnalogVal = 1023;
+      _mapLowVal = 0;
+      _mapHighVal = -1;
+      _hysteresis = 0;
+
+      if(_numMapping > WIDE_POTI_MAX_MAPPING){
+        _numMapping = WIDE_POTI_MAX_MAPPING;
+      }
+
+      if(_numMapping < 2){
+        _numMapping = 2;
+      }
+    }
+
+
+    /*
+      Returns the number of defined mapping values.
+      This can differ to the originally given instantiation
+      parameter "numMapping" due to necessary corrections.
+
+      @returns  internally set and possibly corrected number
+                of mapping values
+    */
+    uint16_t getNumMappingValues(){
+      return _numMapping;
+    }
+
+
+    /*
+      Returns the range of analog values of a mapping value, e.g. for
+      the feedback of LED rings or for the target of motorized faders.
+      The hysteresis is not included.
+
+      @param    mapValue  mapping value from 0 to getNumMappingValues()-1
+      @param    low       lowest analog value of the mapping value
+      @param    high      highest analog value of the mapping value,
+                          low-1 for a not reached mapping value
+      @returns            true, if the mapping value is reached by any analog value
+    */
+    bool getRawRangeForMapping(uint16_t mapValue, int& low, int& high){
+      if(mapValue >= _numMapping){
+        low = _maxAnalogVal + 1;
+        high = _maxAnalogVal;
+        return false;
+      }
+      low = calcWideBoundary(mapValue, _numMapping, _maxAnalogVal);
+      high = calcWideBoundary(mapValue + 1, _numMapping, _maxAnalogVal) - 1;
+      return low <= high;
+    }
+
+
+    /*
+      Returns the maximum analog value with which the internal
+      mapping calcuation is done. Can be the default value (1023)
+      or the overwritten value from function setMaxAnalogValue().
+      The value is always an uneven number.
+
+      @returns  internally set maximum analog value
+    */
+    int getMaxAnalogValue(){
+      return _maxAnalogVal;
+    }
+
+
+    /*
+      Sets and returns the maximum analog value with which the
+      internal mapping calculation shall be done. Will overwrite
+      the default value (1023). The value must be always an uneven
+      number and will, in case of an even one, decreased by 1.
+
+      If the maximum number of analog values is not the default 1023,
+      then this function must be called before first use of function
+      hasChanged() to set the real maximum number (e.g. 4095).
+
+      @param    maxAnalogVal  the maximum analog value for the internal
+                              calculations. Must be an uneven number.
+      @returns                internally set maximum analog value
+    */
+    int setMaxAnalogValue(int maxAnalogVal){
+      if((maxAnalogVal & 0x0001) == 0){
+        _maxAnalogVal = maxAnalogVal - 1;
+      }
+      else{
+        _maxAnalogVal = maxAnalogVal;
+      }
+      return _maxAnalogVal;
+    }
+
+
+    /*
+      Defines a hysteresis band around each mapping boundary. The mapping
+      value changes only, when the analog value has crossed the boundary
+      by at least the given number of analog values. The first mapping
+      value is always set directly.
+
+      @param  hysteresis  Number of analog values from 0 to 255.
+                          Value 0 (default) means no hysteresis. Should be
+                          less than half of the analog values per mapping value.
+    */
+    void setHysteresis(uint8_t hysteresis){
+      _hysteresis = hysteresis;
+    }
+
+
+    /*
+      Returns the information, if mapping value has changed between this
+      and the previous call.
+
+      The function must be called continously, at least once per loop run. It
+      will measure raw values, calculate stabilization and mapping, identify
+      changes and set current and previous values and mappings.
+
+      @returns  true, if current mapping value has changed or when called
+                first time
+    */
+    bool hasChanged(){
+      int rawValue = getStabilizedRawValue();
+      uint16_t prevMapValue = _curMapValue;
+
+      if(rawValue == POTI_VALUE_UNDEFINED){
+        return false;
+      }
+
+      // still in the range of the current mapping value?
+      if(rawValue >= _mapLowVal && rawValue <= _mapHighVal){
+        return false;
+      }
+
+      // boundary not crossed by more than the hysteresis?
+      if(_curMapValue != WIDE_POTI_MAPPING_UNDEFINED){
+        if(rawValue > _mapHighVal && rawValue - _hysteresis <= _mapHighVal){
+          return false;
+        }
+        if(rawValue < _mapLowVal && rawValue + _hysteresis >= _mapLowVal){
+          return false;
+        }
+      }
+
+      updateMapping(rawValue);
+      _prevValue = _curValue;
+      _curValue = rawValue;
+      _prevMapValue = prevMapValue;
+      return true;
+    }
+
+
+    /*
+      Returns current mapping value suitable to the analog value
+      given by getValue(). The value was calculated and set by the
+      last call of hasChanged() that returned true.
+
+      @returns  current mapping value in range 0 to numMapping-1
+                or WIDE_POTI_MAPPING_UNDEFINED before first call of hasChanged()
+    */
+    uint16_t getMappedValue(){
+      return _curMapValue;
+    }
+
+
+    /*
+      Returns previous mapping value. The value was calculated and
+      set by the last call of hasChanged() that returned true.
+      This previous mapping value was the current mapping value before
+      hasChanged() was called.
+
+      @returns  previous mapping value from 0 to numMapping-1
+                or WIDE_POTI_MAPPING_UNDEFINED before hasChanged() has
+                returned true two times
+    */
+    uint16_t getMappedPrevValue(){
+      return _prevMapValue;
+    }
+
+
+    /*
+      Reset all internal values, so that the behavior is like directly after the
+      instantiation and before first call of hasChanged().
+    */
+    void reset(){
+      StablePoti::reset();
+      _curMapValue = WIDE_POTI_MAPPING_UNDEFINED;
+      _prevMapValue = WIDE_POTI_MAPPING_UNDEFINED;
+      _mapLowVal = 0;
+      _mapHighVal = -1;
+    }
+};
+
+
+/*
+  Returns the current or previous mapping value of a WideMappedPoti
+  object (see getPotiMapping() in MappedPoti.h).
+
+  @param    poti    the object
+  @param    prev    true for the previous mapping value
+  @returns          mapping value or WIDE_POTI_MAPPING_UNDEFINED
+*/
+inline uint16_t getPotiMapping(WideMappedPoti& poti, bool prev){
+  return (prev ? poti.getMappedPrevValue() : poti.getMappedValue());
+}
+
+#endif